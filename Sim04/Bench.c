@@ -0,0 +1,474 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Bench.c
+ *
+ *
+ * @version 5.49
+ *          Kristopher Moore (19 October 2026)
+ *          Microbenchmarks of the parser, schedulers, MMU and event logger.
+ */
+
+//needs simRunner for the PCB, EventData and logger definitions
+#include "SimRunner.h"
+
+//scratch meta data file, written and removed by the benchmarks
+#define BENCH_FILE_NAME "SimBench.mdf"
+
+//one benchmark case, timed by runBenchCase
+typedef struct
+{
+   char* benchName;
+   char* caseName;
+   int size;
+   char* unitName;
+   double unitScale;
+
+} BenchCase;
+
+//a timed run, the ns of the timed part and the units of work done in it
+typedef long long (*BenchFunction)( BenchCase* benchCase, long long* work );
+
+//function prototypes
+void setBenchConfig( ConfigDataType* configDataPtr, int schedCode );
+long long writeBenchMetaData( char* fileName, int processCount,
+                                                            int opsPerProcess );
+void runBenchCase( BenchCase* benchCase, BenchFunction benchFunction,
+                                                   int warmup, int repeats );
+long long benchParser( BenchCase* benchCase, long long* work );
+long long benchScheduler( BenchCase* benchCase, long long* work );
+long long benchMmuAllocate( BenchCase* benchCase, long long* work );
+long long benchMmuAccess( BenchCase* benchCase, long long* work );
+long long benchEventLogger( BenchCase* benchCase, long long* work );
+MMU* buildMmuTable( ConfigDataType* configDataPtr, int tableSize );
+
+//scheduler code of the case being run, set before each scheduler case
+static int benchSchedCode = 0;
+
+/*
+Function name: main
+Algorithm: reads the warmup and repeat counts, then runs every benchmark
+            case, printing one CSV line for each
+Precondition: none
+Postcondition: returns zero (0) on success
+Exceptions: bad flags print the usage
+Notes: lines are benchmark,case,size,unit,best,mean,repeats where best and
+       mean are units per second over the timed repeats
+*/
+int main( int argc, char** argv )
+{
+   const int parserSizes[] = { 10000, 100000, 1000000 };
+   const int processCounts[] = { 10, 1000, 100000 };
+   const int tableSizes[] = { 10, 100, 1000 };
+   const int loggerSizes[] = { 100000 };
+   BenchCase benchCase;
+   int warmup = 1;
+   int repeats = 5;
+   int index;
+   int sizeIndex;
+
+   for( index = 1; index < argc; index += 2 )
+   {
+      if( index + 1 < argc && compareString( argv[ index ], "--warmup" )
+                                                                  == STR_EQ )
+      {
+         warmup = atoi( argv[ index + 1 ] );
+      }
+      else if( index + 1 < argc && compareString( argv[ index ], "--repeats" )
+                                                                  == STR_EQ )
+      {
+         repeats = atoi( argv[ index + 1 ] );
+      }
+      else
+      {
+         printf( "Usage: SimBench [--warmup n (1)] [--repeats n (5)]\n" );
+         return 1;
+      }
+   }
+
+   if( warmup < 0 || repeats < 1 )
+   {
+      printf( "Usage: SimBench [--warmup n (1)] [--repeats n (5)]\n" );
+      return 1;
+   }
+
+   printf( "benchmark,case,size,unit,best,mean,repeats\n" );
+
+   //meta data parsing, in MB of file read
+   benchCase.benchName = "getOpCodes";
+   benchCase.caseName = "ops";
+   benchCase.unitName = "MB/s";
+   benchCase.unitScale = 1e-6;
+   for( sizeIndex = 0; sizeIndex < 3; sizeIndex++ )
+   {
+      benchCase.size = parserSizes[ sizeIndex ];
+      runBenchCase( &benchCase, benchParser, warmup, repeats );
+   }
+
+   //scheduler decisions, by every registered policy and process count
+   benchCase.benchName = "scheduler";
+   benchCase.unitName = "decisions/s";
+   benchCase.unitScale = 1.0;
+   for( benchSchedCode = 0; findSchedulerCode(
+            getSchedulerPolicy( benchSchedCode )->name ) == benchSchedCode;
+                                                            benchSchedCode++ )
+   {
+      benchCase.caseName = getSchedulerPolicy( benchSchedCode )->name;
+      for( sizeIndex = 0; sizeIndex < 3; sizeIndex++ )
+      {
+         benchCase.size = processCounts[ sizeIndex ];
+         runBenchCase( &benchCase, benchScheduler, warmup, repeats );
+      }
+   }
+
+   //MMU allocates and accesses, by table size
+   benchCase.unitName = "ops/s";
+   for( sizeIndex = 0; sizeIndex < 3; sizeIndex++ )
+   {
+      benchCase.size = tableSizes[ sizeIndex ];
+      benchCase.benchName = "mmuAllocate";
+      benchCase.caseName = "table";
+      runBenchCase( &benchCase, benchMmuAllocate, warmup, repeats );
+      benchCase.benchName = "mmuAccess";
+      runBenchCase( &benchCase, benchMmuAccess, warmup, repeats );
+   }
+
+   //event logging, to the log list as when logging to a file
+   benchCase.benchName = "eventLogger";
+   benchCase.caseName = "file";
+   benchCase.unitName = "events/s";
+   benchCase.size = loggerSizes[ 0 ];
+   runBenchCase( &benchCase, benchEventLogger, warmup, repeats );
+
+   remove( BENCH_FILE_NAME );
+   return 0;
+}
+
+/*
+Function name: setBenchConfig
+Algorithm: fills a config as a config file with the defaults would, logging
+            to file, with the given scheduler
+Precondition: none
+Postcondition: config ready for the simulator's modules
+Exceptions: none
+Notes: memory is unlimited, so MMU cases never segfault on size
+*/
+void setBenchConfig( ConfigDataType* configDataPtr, int schedCode )
+{
+   setConfigDefaults( configDataPtr );
+   configDataPtr->version = 1.05;
+   copyString( configDataPtr->metaDataFileName, BENCH_FILE_NAME );
+   configDataPtr->cpuSchedCode = schedCode;
+   configDataPtr->quantumCycles = 3;
+   configDataPtr->memAvailable = 2000000000;
+   configDataPtr->procCycleRate = 10;
+   configDataPtr->ioCycleRate = 20;
+   configDataPtr->logToCode = LOGTO_FILE_CODE;
+   copyString( configDataPtr->logToFileName, "SimBench.lgf" );
+}
+
+/*
+Function name: writeBenchMetaData
+Algorithm: writes processes of P and I/O ops with values from a fixed
+            sequence, so every run parses the same file
+Precondition: none
+Postcondition: returns the bytes written, or -1 if the file cannot be
+               written
+Exceptions: none
+Notes: none
+*/
+long long writeBenchMetaData( char* fileName, int processCount,
+                                                            int opsPerProcess )
+{
+   const char* opStrings[] = { "P(run)", "I(hard drive)", "P(run)",
+                                                               "O(printer)" };
+   FILE* filePtr = fopen( fileName, "w" );
+   long long bytes;
+   int pId;
+   int opIndex;
+
+   if( filePtr == NULL )
+   {
+      return -1;
+   }
+
+   fprintf( filePtr, "Start Program Meta-Data Code:\nS(start)0;\n" );
+   for( pId = 0; pId < processCount; pId++ )
+   {
+      fprintf( filePtr, "A(start)0;" );
+      for( opIndex = 0; opIndex < opsPerProcess; opIndex++ )
+      {
+         fprintf( filePtr, " %s%d;", opStrings[ opIndex % 4 ],
+                                          1 + ( pId * 7 + opIndex * 13 ) % 20 );
+      }
+      fprintf( filePtr, " A(end)0;\n" );
+   }
+   fprintf( filePtr, "S(end)0;\nEnd Program Meta-Data Code.\n" );
+
+   bytes = ftell( filePtr );
+   fclose( filePtr );
+   return bytes;
+}
+
+/*
+Function name: runBenchCase
+Algorithm: runs the case warmup times untimed, then repeats times timed,
+            and prints its best and mean rate
+Precondition: benchCase filled in
+Postcondition: one CSV line printed
+Exceptions: none
+Notes: none
+*/
+void runBenchCase( BenchCase* benchCase, BenchFunction benchFunction,
+                                                   int warmup, int repeats )
+{
+   long long elapsedNs;
+   long long work;
+   double rate;
+   double bestRate = 0.0;
+   double totalRate = 0.0;
+   int index;
+
+   for( index = 0; index < warmup; index++ )
+   {
+      benchFunction( benchCase, &work );
+   }
+
+   for( index = 0; index < repeats; index++ )
+   {
+      elapsedNs = benchFunction( benchCase, &work );
+      if( elapsedNs < 1 )
+      {
+         elapsedNs = 1;
+      }
+
+      rate = work * benchCase->unitScale * 1e9 / elapsedNs;
+      totalRate += rate;
+      if( rate > bestRate )
+      {
+         bestRate = rate;
+      }
+   }
+
+   printf( "%s,%s,%d,%s,%.1f,%.1f,%d\n", benchCase->benchName,
+               benchCase->caseName, benchCase->size, benchCase->unitName,
+                                    bestRate, totalRate / repeats, repeats );
+   fflush( stdout );
+}
+
+/*
+Function name: benchParser
+Algorithm: writes a file of size ops, then times getOpCodes reading it and
+            freeing the list
+Precondition: none
+Postcondition: returns the ns taken, work set to the file size in bytes
+Exceptions: none
+Notes: none
+*/
+long long benchParser( BenchCase* benchCase, long long* work )
+{
+   OpCodeType* mdData = NULL;
+   long long bytes = writeBenchMetaData( BENCH_FILE_NAME,
+                                                benchCase->size / 100, 100 );
+   long long startNs = wallTimeNs();
+   long long elapsedNs;
+
+   getOpCodes( BENCH_FILE_NAME, &mdData );
+   mdData = clearMetaDataList( mdData );
+   elapsedNs = wallTimeNs() - startNs;
+
+   *work = bytes;
+   return elapsedNs;
+}
+
+/*
+Function name: benchScheduler
+Algorithm: queues size processes, then times pick next, charge a quantum
+            and enqueue again, as the runners do for every dispatch
+Precondition: benchSchedCode set to the policy to run
+Postcondition: returns the ns taken, work set to the decisions made
+Exceptions: none
+Notes: every process stays READY, so each decision chooses from them all
+*/
+long long benchScheduler( BenchCase* benchCase, long long* work )
+{
+   ConfigDataType config;
+   Scheduler scheduler;
+   OpCodeType* mdData = NULL;
+   PCB* pcbArray;
+   long long decisions = 1000000;
+   long long index;
+   long long startNs;
+   long long elapsedNs;
+   int processCount;
+   int pId;
+
+   setBenchConfig( &config, benchSchedCode );
+   writeBenchMetaData( BENCH_FILE_NAME, benchCase->size, 4 );
+   getOpCodes( BENCH_FILE_NAME, &mdData );
+   processCount = findProcessCount( mdData, mdData );
+   pcbArray = (PCB*) malloc( sizeof( PCB ) * processCount );
+   createPCBs( pcbArray, mdData, processCount );
+   calcRemainingTimes( pcbArray, &config, processCount );
+
+   //deadlines spread over the processes, for EDF-P
+   for( pId = 0; pId < processCount; pId++ )
+   {
+      pcbArray[ pId ].deadlineUs = ( pId * 7919LL ) % 100000 * 1000;
+      pcbArray[ pId ].pState = READY;
+   }
+
+   schedulerInit( &scheduler, &config, processCount );
+   for( pId = 0; pId < processCount; pId++ )
+   {
+      schedulerEnqueue( &scheduler, &pcbArray[ pId ] );
+   }
+
+   startNs = wallTimeNs();
+   for( index = 0; index < decisions; index++ )
+   {
+      pId = schedulerPickNext( &scheduler );
+      schedulerPreempt( &scheduler, &pcbArray[ pId ], 30, True );
+      schedulerEnqueue( &scheduler, &pcbArray[ pId ] );
+   }
+   elapsedNs = wallTimeNs() - startNs;
+
+   schedulerDestruct( &scheduler );
+   free( pcbArray );
+   clearMetaDataList( mdData );
+
+   *work = decisions;
+   return elapsedNs;
+}
+
+/*
+Function name: buildMmuTable
+Algorithm: allocates tableSize segments of distinct bases to a fresh table
+Precondition: config with enough memory for the bases
+Postcondition: returns the head of the table
+Exceptions: none
+Notes: the head is the placeholder node the runners start with
+*/
+MMU* buildMmuTable( ConfigDataType* configDataPtr, int tableSize )
+{
+   MMU placeholder = fillMMU( -1, -1, -1, -1 );
+   MMU* mmuHeadPtr = addNodeMMU( NULL, &placeholder );
+   int index;
+
+   for( index = 0; index < tableSize; index++ )
+   {
+      mmuAllocate( configDataPtr, mmuHeadPtr, mmuHeadPtr,
+                                    fillMMU( index, 1, index, 999 ) );
+   }
+
+   return mmuHeadPtr;
+}
+
+/*
+Function name: benchMmuAllocate
+Algorithm: times allocating size segments into an empty table
+Precondition: none
+Postcondition: returns the ns taken, work set to the allocations
+Exceptions: none
+Notes: the table grows as it is timed, so the rate is over an average
+       table half the size
+*/
+long long benchMmuAllocate( BenchCase* benchCase, long long* work )
+{
+   ConfigDataType config;
+   MMU* mmuHeadPtr;
+   long long startNs;
+   long long elapsedNs;
+
+   setBenchConfig( &config, CPU_SCHED_FCFS_N_CODE );
+
+   startNs = wallTimeNs();
+   mmuHeadPtr = buildMmuTable( &config, benchCase->size );
+   elapsedNs = wallTimeNs() - startNs;
+
+   clearMMU( mmuHeadPtr );
+   *work = benchCase->size;
+   return elapsedNs;
+}
+
+/*
+Function name: benchMmuAccess
+Algorithm: times accesses spread over every segment of a table of size
+Precondition: none
+Postcondition: returns the ns taken, work set to the accesses
+Exceptions: none
+Notes: none
+*/
+long long benchMmuAccess( BenchCase* benchCase, long long* work )
+{
+   ConfigDataType config;
+   MMU* mmuHeadPtr;
+   long long accesses = 100000;
+   long long index;
+   long long startNs;
+   long long elapsedNs;
+   int base;
+
+   setBenchConfig( &config, CPU_SCHED_FCFS_N_CODE );
+   mmuHeadPtr = buildMmuTable( &config, benchCase->size );
+
+   startNs = wallTimeNs();
+   for( index = 0; index < accesses; index++ )
+   {
+      base = (int) ( index * 7919 % benchCase->size );
+      mmuAccess( &config, mmuHeadPtr, mmuHeadPtr,
+                              fillMMU( base, 1, base, (int) index % 1000 ) );
+   }
+   elapsedNs = wallTimeNs() - startNs;
+
+   clearMMU( mmuHeadPtr );
+   *work = accesses;
+   return elapsedNs;
+}
+
+/*
+Function name: benchEventLogger
+Algorithm: times generating and logging size op start events to a log list
+Precondition: none
+Postcondition: returns the ns taken, work set to the events logged
+Exceptions: none
+Notes: the list is freed untimed, writing it out is not included
+*/
+long long benchEventLogger( BenchCase* benchCase, long long* work )
+{
+   ConfigDataType config;
+   LogLinkedList* listHeadPtr = createLogNode( " " );
+   OpCodeType startOp;
+   OpCodeType runOp;
+   PCB process;
+   EventData eventData;
+   char timeString[ MAX_STR_LEN ];
+   long long startNs;
+   long long elapsedNs;
+   int index;
+
+   setBenchConfig( &config, CPU_SCHED_FCFS_N_CODE );
+   startOp.opLtr = 'A';
+   copyString( startOp.opName, "start" );
+   startOp.opValue = 0;
+   startOp.next = &runOp;
+   runOp.opLtr = 'P';
+   copyString( runOp.opName, "run" );
+   runOp.opValue = 5;
+   runOp.next = NULL;
+   createPCBs( &process, &startOp, 1 );
+   process.remainingTimeMs = 50;
+
+   startNs = wallTimeNs();
+   for( index = 0; index < benchCase->size; index++ )
+   {
+      timeToString( index / 1000000, index % 1000000, timeString );
+      eventData = generateEventData( Process, ProcOpStart, timeString,
+                                                         &runOp, &process );
+      eventLogger( eventData, &config, listHeadPtr );
+   }
+   elapsedNs = wallTimeNs() - startNs;
+
+   clearLinkedList( listHeadPtr );
+   *work = benchCase->size;
+   return elapsedNs;
+}
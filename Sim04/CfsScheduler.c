@@ -0,0 +1,652 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file CfsScheduler.c
+ *
+ *
+ * @version 5.42
+ *          Kristopher Moore (19 October 2026)
+ *          Completely fair scheduling policy, CFS-P.
+ */
+
+//needs simRunner for the PCB definition
+#include "SimRunner.h"
+
+//CFS state, a red-black tree of queued processes ordered by virtual runtime
+//then pId. Nodes live in arrays indexed by pId + 1, so inserts never
+//allocate, and index 0 is the shared black nil leaf
+typedef struct
+{
+   int targetLatencyMs;
+   int minGranularityMs;
+   long long minVruntimeUs;
+   long long queuedWeight;
+   int root;
+   long long* key;
+   int* weight;
+   int* left;
+   int* right;
+   int* parent;
+   char* red;
+
+} CfsState;
+
+//index of the nil leaf
+#define CFS_NIL 0
+
+//static helpers for the tree
+static Boolean cfsLess( CfsState* cfs, int nodeA, int nodeB );
+static void cfsRotateLeft( CfsState* cfs, int node );
+static void cfsRotateRight( CfsState* cfs, int node );
+static void cfsInsert( CfsState* cfs, int node );
+static void cfsInsertFixup( CfsState* cfs, int node );
+static int cfsRemoveMin( CfsState* cfs );
+static void cfsRemoveFixup( CfsState* cfs, int node );
+static void cfsCharge( struct PCB* process, int ranMs );
+
+//policy callbacks, CFS-P
+static void* cfsInit( int processCount, ConfigDataType* configDataPtr );
+static void cfsEnqueue( void* state, struct PCB* process );
+static int cfsPickNext( void* state );
+static void cfsPreempt( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed );
+static void cfsBlock( void* state, struct PCB* process, int ranMs );
+static void cfsExit( void* state, struct PCB* process, int ranMs );
+static int cfsTimeSlice( void* state, struct PCB* process );
+static void cfsDestruct( void* state );
+static void cfsSave( void* state, int processCount, FILE* filePtr );
+static Boolean cfsRestore( void* state, int processCount, FILE* filePtr );
+
+const SchedulerPolicy cfsPPolicy =
+   { "CFS-P", True, cfsInit, cfsEnqueue, cfsPickNext,
+        cfsPreempt, cfsBlock, cfsExit, cfsTimeSlice, cfsDestruct,
+                                                      cfsSave, cfsRestore };
+
+/*
+Function name: cfsInit
+Algorithm: allocates the node arrays for every pId, plus the nil leaf
+Precondition: count of processes in the run
+Postcondition: returns the CFS state with an empty tree
+Exceptions: none
+Notes: the configured quantum is the target latency, the period in which
+       every queued process should run once, and one processor cycle is
+       the minimum granularity, as ops can only be preempted between cycles
+*/
+static void* cfsInit( int processCount, ConfigDataType* configDataPtr )
+{
+   CfsState* cfs = (CfsState*) malloc( sizeof( CfsState ) );
+
+   cfs->targetLatencyMs =
+                     configDataPtr->quantumCycles * configDataPtr->procCycleRate;
+   cfs->minGranularityMs = configDataPtr->procCycleRate;
+   cfs->minVruntimeUs = 0;
+   cfs->queuedWeight = 0;
+   cfs->root = CFS_NIL;
+
+   cfs->key = (long long*) calloc( processCount + 1, sizeof( long long ) );
+   cfs->weight = (int*) calloc( processCount + 1, sizeof( int ) );
+   cfs->left = (int*) calloc( processCount + 1, sizeof( int ) );
+   cfs->right = (int*) calloc( processCount + 1, sizeof( int ) );
+   cfs->parent = (int*) calloc( processCount + 1, sizeof( int ) );
+   cfs->red = (char*) calloc( processCount + 1, sizeof( char ) );
+
+   return cfs;
+}
+
+/*
+Function name: cfsEnqueue
+Algorithm: places the process in the tree by its virtual runtime. A process
+            that has been blocked or never run is first moved up to half a
+            target latency behind the least queued runtime, so it cannot
+            bank credit while it was away
+Precondition: process not already queued
+Postcondition: process queued
+Exceptions: none
+Notes: O(log n)
+*/
+static void cfsEnqueue( void* state, struct PCB* process )
+{
+   CfsState* cfs = (CfsState*) state;
+   int node = process->pId + 1;
+   long long floorUs =
+                  cfs->minVruntimeUs - cfs->targetLatencyMs * 1000LL / 2;
+
+   if( process->vruntimeUs < floorUs )
+   {
+      process->vruntimeUs = floorUs;
+   }
+
+   cfs->key[ node ] = process->vruntimeUs;
+   cfs->weight[ node ] = process->weight;
+   cfs->queuedWeight += process->weight;
+
+   cfsInsert( cfs, node );
+}
+
+/*
+Function name: cfsPickNext
+Algorithm: removes the leftmost node, the least virtual runtime, and moves
+            the runtime floor up to it
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int cfsPickNext( void* state )
+{
+   CfsState* cfs = (CfsState*) state;
+   int node = cfsRemoveMin( cfs );
+
+   cfs->queuedWeight -= cfs->weight[ node ];
+
+   if( cfs->key[ node ] > cfs->minVruntimeUs )
+   {
+      cfs->minVruntimeUs = cfs->key[ node ];
+   }
+
+   return node - 1;
+}
+
+/*
+Function name: cfsPreempt
+Algorithm: charges the run to the process's virtual runtime
+Precondition: process was RUNNING for ranMs
+Postcondition: virtual runtime updated
+Exceptions: none
+Notes: none
+*/
+static void cfsPreempt( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed )
+{
+   cfsCharge( process, ranMs );
+}
+
+/*
+Function name: cfsBlock
+Algorithm: charges the run to the process's virtual runtime
+Precondition: process was RUNNING for ranMs, now BLOCKED
+Postcondition: virtual runtime updated
+Exceptions: none
+Notes: none
+*/
+static void cfsBlock( void* state, struct PCB* process, int ranMs )
+{
+   cfsCharge( process, ranMs );
+}
+
+/*
+Function name: cfsExit
+Algorithm: charges the last run to the process's virtual runtime
+Precondition: process was RUNNING for ranMs, now EXIT
+Postcondition: virtual runtime updated
+Exceptions: none
+Notes: none
+*/
+static void cfsExit( void* state, struct PCB* process, int ranMs )
+{
+   cfsCharge( process, ranMs );
+}
+
+/*
+Function name: cfsTimeSlice
+Algorithm: gives the process its weighted share of the target latency among
+            the processes still queued, at least the minimum granularity,
+            rounded down to whole cycles
+Precondition: process about to run a P op, already taken from the tree
+Postcondition: returns the slice in ms, 0 if no quantum is configured
+Exceptions: none
+Notes: none
+*/
+static int cfsTimeSlice( void* state, struct PCB* process )
+{
+   CfsState* cfs = (CfsState*) state;
+   long long sliceMs;
+
+   if( cfs->targetLatencyMs == 0 || cfs->minGranularityMs == 0 )
+   {
+      return 0;
+   }
+
+   sliceMs = cfs->targetLatencyMs * (long long) process->weight
+                                 / ( cfs->queuedWeight + process->weight );
+
+   if( sliceMs < cfs->minGranularityMs )
+   {
+      return cfs->minGranularityMs;
+   }
+
+   return (int) ( sliceMs - sliceMs % cfs->minGranularityMs );
+}
+
+/*
+Function name: cfsDestruct
+Algorithm: frees the node arrays and the state
+Precondition: state from cfsInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void cfsDestruct( void* state )
+{
+   CfsState* cfs = (CfsState*) state;
+
+   free( cfs->key );
+   free( cfs->weight );
+   free( cfs->left );
+   free( cfs->right );
+   free( cfs->parent );
+   free( cfs->red );
+   free( cfs );
+}
+
+/*
+Function name: cfsSave
+Algorithm: writes the runtime floor, queued weight, root and the node arrays
+Precondition: state from cfsInit
+Postcondition: state written
+Exceptions: none
+Notes: none
+*/
+static void cfsSave( void* state, int processCount, FILE* filePtr )
+{
+   CfsState* cfs = (CfsState*) state;
+   int nodeCount = processCount + 1;
+
+   fwrite( &cfs->minVruntimeUs, sizeof( long long ), 1, filePtr );
+   fwrite( &cfs->queuedWeight, sizeof( long long ), 1, filePtr );
+   fwrite( &cfs->root, sizeof( int ), 1, filePtr );
+   fwrite( cfs->key, sizeof( long long ), nodeCount, filePtr );
+   fwrite( cfs->weight, sizeof( int ), nodeCount, filePtr );
+   fwrite( cfs->left, sizeof( int ), nodeCount, filePtr );
+   fwrite( cfs->right, sizeof( int ), nodeCount, filePtr );
+   fwrite( cfs->parent, sizeof( int ), nodeCount, filePtr );
+   fwrite( cfs->red, sizeof( char ), nodeCount, filePtr );
+}
+
+/*
+Function name: cfsRestore
+Algorithm: reads back what cfsSave wrote
+Precondition: state fresh from cfsInit, for the same process count
+Postcondition: returns True with the tree as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean cfsRestore( void* state, int processCount, FILE* filePtr )
+{
+   CfsState* cfs = (CfsState*) state;
+   int nodeCount = processCount + 1;
+   size_t readCount = 0;
+
+   readCount += fread( &cfs->minVruntimeUs, sizeof( long long ), 1, filePtr );
+   readCount += fread( &cfs->queuedWeight, sizeof( long long ), 1, filePtr );
+   readCount += fread( &cfs->root, sizeof( int ), 1, filePtr );
+   readCount += fread( cfs->key, sizeof( long long ), nodeCount, filePtr );
+   readCount += fread( cfs->weight, sizeof( int ), nodeCount, filePtr );
+   readCount += fread( cfs->left, sizeof( int ), nodeCount, filePtr );
+   readCount += fread( cfs->right, sizeof( int ), nodeCount, filePtr );
+   readCount += fread( cfs->parent, sizeof( int ), nodeCount, filePtr );
+   readCount += fread( cfs->red, sizeof( char ), nodeCount, filePtr );
+
+   return readCount == (size_t) ( nodeCount * 6 + 3 ) ? True : False;
+}
+
+/*
+Function name: cfsCharge
+Algorithm: adds the run to the virtual runtime, scaled so heavier processes
+            age more slowly
+Precondition: ranMs of CPU time just used
+Postcondition: virtual runtime updated
+Exceptions: none
+Notes: none
+*/
+static void cfsCharge( struct PCB* process, int ranMs )
+{
+   process->vruntimeUs +=
+               ranMs * 1000LL * SCHED_DEFAULT_WEIGHT / process->weight;
+}
+
+/*
+Function name: cfsLess
+Algorithm: orders nodes by key, breaking ties by pId
+Precondition: two queued nodes
+Postcondition: returns True if nodeA sorts before nodeB
+Exceptions: none
+Notes: none
+*/
+static Boolean cfsLess( CfsState* cfs, int nodeA, int nodeB )
+{
+   if( cfs->key[ nodeA ] != cfs->key[ nodeB ] )
+   {
+      return cfs->key[ nodeA ] < cfs->key[ nodeB ];
+   }
+
+   return nodeA < nodeB;
+}
+
+/*
+Function name: cfsRotateLeft
+Algorithm: lifts the node's right child into its place
+Precondition: node has a right child
+Postcondition: subtree rotated, order kept
+Exceptions: none
+Notes: none
+*/
+static void cfsRotateLeft( CfsState* cfs, int node )
+{
+   int child = cfs->right[ node ];
+
+   cfs->right[ node ] = cfs->left[ child ];
+   if( cfs->left[ child ] != CFS_NIL )
+   {
+      cfs->parent[ cfs->left[ child ] ] = node;
+   }
+
+   cfs->parent[ child ] = cfs->parent[ node ];
+   if( cfs->parent[ node ] == CFS_NIL )
+   {
+      cfs->root = child;
+   }
+
+   else if( node == cfs->left[ cfs->parent[ node ] ] )
+   {
+      cfs->left[ cfs->parent[ node ] ] = child;
+   }
+
+   else
+   {
+      cfs->right[ cfs->parent[ node ] ] = child;
+   }
+
+   cfs->left[ child ] = node;
+   cfs->parent[ node ] = child;
+}
+
+/*
+Function name: cfsRotateRight
+Algorithm: lifts the node's left child into its place
+Precondition: node has a left child
+Postcondition: subtree rotated, order kept
+Exceptions: none
+Notes: none
+*/
+static void cfsRotateRight( CfsState* cfs, int node )
+{
+   int child = cfs->left[ node ];
+
+   cfs->left[ node ] = cfs->right[ child ];
+   if( cfs->right[ child ] != CFS_NIL )
+   {
+      cfs->parent[ cfs->right[ child ] ] = node;
+   }
+
+   cfs->parent[ child ] = cfs->parent[ node ];
+   if( cfs->parent[ node ] == CFS_NIL )
+   {
+      cfs->root = child;
+   }
+
+   else if( node == cfs->right[ cfs->parent[ node ] ] )
+   {
+      cfs->right[ cfs->parent[ node ] ] = child;
+   }
+
+   else
+   {
+      cfs->left[ cfs->parent[ node ] ] = child;
+   }
+
+   cfs->right[ child ] = node;
+   cfs->parent[ node ] = child;
+}
+
+/*
+Function name: cfsInsert
+Algorithm: binary search tree insert of a red node, then rebalances
+Precondition: node key set, node not in the tree
+Postcondition: node in the tree, red-black properties hold
+Exceptions: none
+Notes: none
+*/
+static void cfsInsert( CfsState* cfs, int node )
+{
+   int parentNode = CFS_NIL;
+   int current = cfs->root;
+
+   while( current != CFS_NIL )
+   {
+      parentNode = current;
+      if( cfsLess( cfs, node, current ) == True )
+      {
+         current = cfs->left[ current ];
+      }
+
+      else
+      {
+         current = cfs->right[ current ];
+      }
+   }
+
+   cfs->parent[ node ] = parentNode;
+   if( parentNode == CFS_NIL )
+   {
+      cfs->root = node;
+   }
+
+   else if( cfsLess( cfs, node, parentNode ) == True )
+   {
+      cfs->left[ parentNode ] = node;
+   }
+
+   else
+   {
+      cfs->right[ parentNode ] = node;
+   }
+
+   cfs->left[ node ] = CFS_NIL;
+   cfs->right[ node ] = CFS_NIL;
+   cfs->red[ node ] = True;
+
+   cfsInsertFixup( cfs, node );
+}
+
+/*
+Function name: cfsInsertFixup
+Algorithm: recolours and rotates up from a new red node until no red node
+            has a red parent
+Precondition: node just inserted red
+Postcondition: red-black properties hold, root is black
+Exceptions: none
+Notes: none
+*/
+static void cfsInsertFixup( CfsState* cfs, int node )
+{
+   int uncle;
+
+   while( cfs->red[ cfs->parent[ node ] ] == True )
+   {
+      if( cfs->parent[ node ]
+                        == cfs->left[ cfs->parent[ cfs->parent[ node ] ] ] )
+      {
+         uncle = cfs->right[ cfs->parent[ cfs->parent[ node ] ] ];
+         if( cfs->red[ uncle ] == True )
+         {
+            cfs->red[ cfs->parent[ node ] ] = False;
+            cfs->red[ uncle ] = False;
+            cfs->red[ cfs->parent[ cfs->parent[ node ] ] ] = True;
+            node = cfs->parent[ cfs->parent[ node ] ];
+         }
+
+         else
+         {
+            if( node == cfs->right[ cfs->parent[ node ] ] )
+            {
+               node = cfs->parent[ node ];
+               cfsRotateLeft( cfs, node );
+            }
+
+            cfs->red[ cfs->parent[ node ] ] = False;
+            cfs->red[ cfs->parent[ cfs->parent[ node ] ] ] = True;
+            cfsRotateRight( cfs, cfs->parent[ cfs->parent[ node ] ] );
+         }
+      }
+
+      else
+      {
+         uncle = cfs->left[ cfs->parent[ cfs->parent[ node ] ] ];
+         if( cfs->red[ uncle ] == True )
+         {
+            cfs->red[ cfs->parent[ node ] ] = False;
+            cfs->red[ uncle ] = False;
+            cfs->red[ cfs->parent[ cfs->parent[ node ] ] ] = True;
+            node = cfs->parent[ cfs->parent[ node ] ];
+         }
+
+         else
+         {
+            if( node == cfs->left[ cfs->parent[ node ] ] )
+            {
+               node = cfs->parent[ node ];
+               cfsRotateRight( cfs, node );
+            }
+
+            cfs->red[ cfs->parent[ node ] ] = False;
+            cfs->red[ cfs->parent[ cfs->parent[ node ] ] ] = True;
+            cfsRotateLeft( cfs, cfs->parent[ cfs->parent[ node ] ] );
+         }
+      }
+   }
+
+   cfs->red[ cfs->root ] = False;
+}
+
+/*
+Function name: cfsRemoveMin
+Algorithm: walks to the leftmost node, splices in its right child, and
+            rebalances if a black node was removed
+Precondition: tree not empty
+Postcondition: returns the removed node, red-black properties hold
+Exceptions: none
+Notes: the leftmost node has no left child, so this is the simple case of
+       a red-black delete
+*/
+static int cfsRemoveMin( CfsState* cfs )
+{
+   int node = cfs->root;
+   int child;
+
+   while( cfs->left[ node ] != CFS_NIL )
+   {
+      node = cfs->left[ node ];
+   }
+
+   child = cfs->right[ node ];
+
+   //the nil leaf's parent is set too, the fixup walks up from it
+   cfs->parent[ child ] = cfs->parent[ node ];
+   if( cfs->parent[ node ] == CFS_NIL )
+   {
+      cfs->root = child;
+   }
+
+   else
+   {
+      cfs->left[ cfs->parent[ node ] ] = child;
+   }
+
+   if( cfs->red[ node ] == False )
+   {
+      cfsRemoveFixup( cfs, child );
+   }
+
+   return node;
+}
+
+/*
+Function name: cfsRemoveFixup
+Algorithm: pushes the extra black left by a removal up the tree, by
+            recolouring and rotating around the sibling
+Precondition: node took the place of a removed black node
+Postcondition: red-black properties hold
+Exceptions: none
+Notes: none
+*/
+static void cfsRemoveFixup( CfsState* cfs, int node )
+{
+   int sibling;
+
+   while( node != cfs->root && cfs->red[ node ] == False )
+   {
+      if( node == cfs->left[ cfs->parent[ node ] ] )
+      {
+         sibling = cfs->right[ cfs->parent[ node ] ];
+         if( cfs->red[ sibling ] == True )
+         {
+            cfs->red[ sibling ] = False;
+            cfs->red[ cfs->parent[ node ] ] = True;
+            cfsRotateLeft( cfs, cfs->parent[ node ] );
+            sibling = cfs->right[ cfs->parent[ node ] ];
+         }
+
+         if( cfs->red[ cfs->left[ sibling ] ] == False
+                                 && cfs->red[ cfs->right[ sibling ] ] == False )
+         {
+            cfs->red[ sibling ] = True;
+            node = cfs->parent[ node ];
+         }
+
+         else
+         {
+            if( cfs->red[ cfs->right[ sibling ] ] == False )
+            {
+               cfs->red[ cfs->left[ sibling ] ] = False;
+               cfs->red[ sibling ] = True;
+               cfsRotateRight( cfs, sibling );
+               sibling = cfs->right[ cfs->parent[ node ] ];
+            }
+
+            cfs->red[ sibling ] = cfs->red[ cfs->parent[ node ] ];
+            cfs->red[ cfs->parent[ node ] ] = False;
+            cfs->red[ cfs->right[ sibling ] ] = False;
+            cfsRotateLeft( cfs, cfs->parent[ node ] );
+            node = cfs->root;
+         }
+      }
+
+      else
+      {
+         sibling = cfs->left[ cfs->parent[ node ] ];
+         if( cfs->red[ sibling ] == True )
+         {
+            cfs->red[ sibling ] = False;
+            cfs->red[ cfs->parent[ node ] ] = True;
+            cfsRotateRight( cfs, cfs->parent[ node ] );
+            sibling = cfs->left[ cfs->parent[ node ] ];
+         }
+
+         if( cfs->red[ cfs->right[ sibling ] ] == False
+                                 && cfs->red[ cfs->left[ sibling ] ] == False )
+         {
+            cfs->red[ sibling ] = True;
+            node = cfs->parent[ node ];
+         }
+
+         else
+         {
+            if( cfs->red[ cfs->left[ sibling ] ] == False )
+            {
+               cfs->red[ cfs->right[ sibling ] ] = False;
+               cfs->red[ sibling ] = True;
+               cfsRotateLeft( cfs, sibling );
+               sibling = cfs->left[ cfs->parent[ node ] ];
+            }
+
+            cfs->red[ sibling ] = cfs->red[ cfs->parent[ node ] ];
+            cfs->red[ cfs->parent[ node ] ] = False;
+            cfs->red[ cfs->left[ sibling ] ] = False;
+            cfsRotateRight( cfs, cfs->parent[ node ] );
+            node = cfs->root;
+         }
+      }
+   }
+
+   cfs->red[ node ] = False;
+}
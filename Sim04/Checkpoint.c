@@ -0,0 +1,805 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Checkpoint.c
+ *
+ *
+ * @version 5.52
+ *          Kristopher Moore (19 October 2026)
+ *          Checkpoint and restore of a virtual clock simulation.
+ */
+
+//sigaction and SIGUSR1 are POSIX, not C99
+#define _POSIX_C_SOURCE 200809L
+
+#include <signal.h>
+#include <stdint.h>
+#include <string.h>
+
+//needs simRunner for the EventSimulation definition
+#include "SimRunner.h"
+
+//first bytes of every checkpoint, the last digit is the format version
+#define CHECKPOINT_MAGIC "SIM04CK2"
+#define CHECKPOINT_MAGIC_LEN 8
+
+//FNV-1a, for the fingerprint of a run's settings and meta data
+#define FINGERPRINT_BASIS 14695981039346656037ULL
+#define FINGERPRINT_PRIME 1099511628211ULL
+
+//checkpoint header, a checkpoint is only restored by a run of the same
+//build, over the same meta data, with the same simulation settings
+typedef struct
+{
+   char magic[ CHECKPOINT_MAGIC_LEN ];
+   int layoutSizes[ 5 ];
+   int cpuSchedCode;
+   int coreCount;
+   int processCount;
+   int opCount;
+   unsigned long long fingerprint;
+
+} CheckpointHeader;
+
+//address of an op, for finding a program counter's place in the meta data
+typedef struct
+{
+   uintptr_t address;
+   int index;
+
+} OpCodeIndex;
+
+//set by SIGUSR1, taken by the event loop at its next pass
+static volatile sig_atomic_t checkpointRequested = 0;
+
+//static helpers
+static void checkpointSignal( int signalNumber );
+static void fillHeader( CheckpointHeader* header, EventSimulation* sim,
+                                       OpCodeType** opCodes, int opCount );
+static unsigned long long fingerprintRun( ConfigDataType* configDataPtr,
+                                       OpCodeType** opCodes, int opCount );
+static unsigned long long fingerprintAdd( unsigned long long hash,
+                                          const void* bytes, size_t length );
+static OpCodeType** listOpCodes( OpCodeType* mdData, int* opCount );
+static int compareOpCodeIndex( const void* first, const void* second );
+static void saveState( EventSimulation* sim, OpCodeType* mdData,
+                                                            FILE* filePtr );
+static Boolean restorePCBs( EventSimulation* sim, OpCodeType** opCodes,
+                                             int opCount, FILE* filePtr );
+static Boolean restoreDevice( EventSimulation* sim, Device* device,
+                                                            FILE* filePtr );
+static Boolean restoreLists( EventSimulation* sim, FILE* filePtr );
+static Boolean readItems( FILE* filePtr, void* items, size_t itemSize,
+                                                               size_t count );
+
+/*
+Function name: checkpointArm
+Algorithm: listens for SIGUSR1 when the config names a checkpoint file, and
+            sets the simulated time of the first periodic checkpoint
+Precondition: sim clock set, or restored, config data loaded
+Postcondition: checkpoints will be taken when due
+Exceptions: none
+Notes: the signal only sets a flag, the checkpoint itself is written by the
+       event loop between events, where the state is whole
+*/
+void checkpointArm( EventSimulation* sim )
+{
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+   long long intervalUs = configDataPtr->checkpointIntervalMs * 1000LL;
+   struct sigaction signalAction;
+
+   sim->nextCheckpointUs = intervalUs > 0
+                     ? ( sim->clockUs / intervalUs + 1 ) * intervalUs : -1;
+
+   if( configDataPtr->checkpointFileName[ 0 ] == NULL_CHAR )
+   {
+      return;
+   }
+
+   signalAction.sa_handler = checkpointSignal;
+   sigemptyset( &signalAction.sa_mask );
+   signalAction.sa_flags = SA_RESTART;
+   sigaction( SIGUSR1, &signalAction, NULL );
+}
+
+/*
+Function name: checkpointDue
+Algorithm: a checkpoint is due once SIGUSR1 has been received, or the
+            virtual clock has reached the next interval
+Precondition: checkpointArm called for the run
+Postcondition: returns True when the loop should write a checkpoint
+Exceptions: none
+Notes: two compares unless a checkpoint file is named, so it is cheap
+       enough to ask on every pass of the event loop
+*/
+Boolean checkpointDue( EventSimulation* sim )
+{
+   if( sim->configDataPtr->checkpointFileName[ 0 ] == NULL_CHAR )
+   {
+      return False;
+   }
+
+   if( checkpointRequested != 0 )
+   {
+      checkpointRequested = 0;
+      return True;
+   }
+
+   if( sim->nextCheckpointUs >= 0 && sim->clockUs >= sim->nextCheckpointUs )
+   {
+      return True;
+   }
+
+   return False;
+}
+
+/*
+Function name: writeCheckpoint
+Algorithm: writes the whole simulation state to a temporary file, then
+            renames it over the checkpoint file, and sets the next interval
+Precondition: called between events of the event loop
+Postcondition: returns True with the checkpoint file replaced
+Exceptions: an unwritable file is reported, the last good checkpoint is left
+            in place, and the run goes on
+Notes: the rename means a run killed while writing never leaves a partial
+       checkpoint behind
+*/
+Boolean writeCheckpoint( EventSimulation* sim, OpCodeType* mdData )
+{
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+   long long intervalUs = configDataPtr->checkpointIntervalMs * 1000LL;
+   char tempFileName[ MAX_STR_LEN ];
+   FILE* filePtr;
+   Boolean written;
+
+   if( intervalUs > 0 )
+   {
+      sim->nextCheckpointUs = ( sim->clockUs / intervalUs + 1 ) * intervalUs;
+   }
+
+   copyString( tempFileName, configDataPtr->checkpointFileName );
+   concatenateString( tempFileName, ".tmp" );
+
+   filePtr = fopen( tempFileName, "wb" );
+   if( filePtr == NULL )
+   {
+      printf( "Checkpoint file %s could not be opened\n", tempFileName );
+      return False;
+   }
+
+   saveState( sim, mdData, filePtr );
+
+   written = ferror( filePtr ) == 0 ? True : False;
+   if( fclose( filePtr ) != 0 )
+   {
+      written = False;
+   }
+
+   if( written == False
+         || rename( tempFileName, configDataPtr->checkpointFileName ) != 0 )
+   {
+      printf( "Checkpoint file %s could not be written\n",
+                                          configDataPtr->checkpointFileName );
+      remove( tempFileName );
+      return False;
+   }
+
+   return True;
+}
+
+/*
+Function name: restoreCheckpoint
+Algorithm: checks the header against this run, then reads every part of the
+            state back in the order saveState wrote it
+Precondition: sim built as eventSimulationRunner builds it, PCBs, cores,
+              schedulers, devices and calendar allocated, nothing logged and
+              nothing on the calendar
+Postcondition: returns True with the simulation where the checkpoint left it
+Exceptions: returns False, with a message, when the file can not be opened,
+            is from another build, run or meta data, or is cut short
+Notes: the state left by a failed restore is only fit to be destructed
+*/
+Boolean restoreCheckpoint( EventSimulation* sim, OpCodeType* mdData )
+{
+   char* fileName = sim->configDataPtr->restoreFileName;
+   CheckpointHeader header;
+   CheckpointHeader expected;
+   OpCodeType** opCodes;
+   FILE* filePtr;
+   int opCount;
+   int index;
+   Boolean intact;
+
+   filePtr = fopen( fileName, "rb" );
+   if( filePtr == NULL )
+   {
+      printf( "Checkpoint file %s could not be opened\n", fileName );
+      return False;
+   }
+
+   opCodes = listOpCodes( mdData, &opCount );
+   fillHeader( &expected, sim, opCodes, opCount );
+
+   intact = readItems( filePtr, &header, sizeof( header ), 1 );
+   if( intact == False
+            || memcmp( &header, &expected, sizeof( header ) ) != 0 )
+   {
+      printf( "Checkpoint file %s is not from this build, config"
+                                          " and meta data\n", fileName );
+      free( opCodes );
+      fclose( filePtr );
+      return False;
+   }
+
+   //clock, totals and the interrupts held for the next batch
+   intact = readItems( filePtr, &sim->clockUs, sizeof( long long ), 1 )
+      && readItems( filePtr, &sim->eventCount, sizeof( long long ), 1 )
+      && readItems( filePtr, &sim->exitCount, sizeof( int ), 1 )
+      && readItems( filePtr, &sim->staggeredArrivals, sizeof( Boolean ), 1 )
+      && readItems( filePtr, &sim->pendingCount, sizeof( int ), 1 )
+      && readItems( filePtr, &sim->pendingSinceUs, sizeof( long long ), 1 )
+      && readItems( filePtr, &sim->interruptStats,
+                                             sizeof( InterruptStats ), 1 )
+      && readItems( filePtr, &sim->deadlineStats, sizeof( DeadlineStats ), 1 )
+      && readItems( filePtr, &sim->latencyStats, sizeof( LatencyStats ), 1 )
+      && sim->pendingCount >= 0 && sim->pendingCount <= sim->processCount
+      && readItems( filePtr, sim->pendingInterrupts, sizeof( int ),
+                                                         sim->pendingCount )
+      && readItems( filePtr, sim->pendingRaisedUs, sizeof( long long ),
+                                                         sim->pendingCount );
+
+   //processes, then the cores and run queues that hold them
+   intact = intact && restorePCBs( sim, opCodes, opCount, filePtr )
+      && readItems( filePtr, sim->cores, sizeof( SimCore ), sim->coreCount );
+
+   for( index = 0; intact == True && index < sim->coreCount; index++ )
+   {
+      intact = schedulerRestore( &sim->schedulers[ index ], sim->processCount,
+                                                                   filePtr );
+   }
+
+   //calendar, I/O in flight is its interrupt event still to come
+   intact = intact && readItems( filePtr, &sim->eventQueue.size,
+                                                         sizeof( int ), 1 )
+      && readItems( filePtr, &sim->eventQueue.nextSequence,
+                                                   sizeof( long long ), 1 )
+      && sim->eventQueue.size >= 0;
+   if( intact == True && sim->eventQueue.size > sim->eventQueue.capacity )
+   {
+      sim->eventQueue.capacity = sim->eventQueue.size;
+      sim->eventQueue.heap = (SimEvent*) realloc( sim->eventQueue.heap,
+                              sizeof( SimEvent ) * sim->eventQueue.capacity );
+   }
+   intact = intact && readItems( filePtr, sim->eventQueue.heap,
+                              sizeof( SimEvent ), sim->eventQueue.size );
+
+   //devices, with their queued requests
+   intact = intact && readItems( filePtr, &sim->deviceTable.startUs,
+                                                   sizeof( long long ), 1 );
+   for( index = 0; intact == True && index < DEVICE_COUNT; index++ )
+   {
+      intact = restoreDevice( sim, &sim->deviceTable.devices[ index ],
+                                                                   filePtr );
+   }
+
+   //MMU table and log, nothing after them
+   intact = intact && restoreLists( sim, filePtr )
+                                             && fgetc( filePtr ) == EOF;
+
+   free( opCodes );
+   fclose( filePtr );
+
+   if( intact == False )
+   {
+      //requests are owned by the PCBs until the restore is whole
+      for( index = 0; index < DEVICE_COUNT; index++ )
+      {
+         sim->deviceTable.devices[ index ].queueHead = NULL;
+         sim->deviceTable.devices[ index ].queueTail = NULL;
+         sim->deviceTable.devices[ index ].queueLength = 0;
+      }
+      for( index = 0; index < sim->processCount; index++ )
+      {
+         free( sim->pcbArray[ index ].ioRequest );
+         sim->pcbArray[ index ].ioRequest = NULL;
+      }
+      sim->eventQueue.size = 0;
+      printf( "Checkpoint file %s is incomplete or corrupt\n", fileName );
+      return False;
+   }
+
+   return True;
+}
+
+/*
+Function name: checkpointSignal
+Algorithm: SIGUSR1 handler, asks for a checkpoint
+Precondition: installed by checkpointArm
+Postcondition: flag set
+Exceptions: none
+Notes: only touches a sig_atomic_t, so it is safe in a handler
+*/
+static void checkpointSignal( int signalNumber )
+{
+   checkpointRequested = 1;
+}
+
+/*
+Function name: fillHeader
+Algorithm: fills a header for this build, policy, core and process counts,
+            and the fingerprint of the run's settings and meta data
+Precondition: sim has its processes built, opCodes from listOpCodes
+Postcondition: header filled, padding zeroed so headers compare by bytes
+Exceptions: none
+Notes: the structure sizes catch a checkpoint from a different build
+*/
+static void fillHeader( CheckpointHeader* header, EventSimulation* sim,
+                                          OpCodeType** opCodes, int opCount )
+{
+   memset( header, 0, sizeof( CheckpointHeader ) );
+   memcpy( header->magic, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_LEN );
+   header->layoutSizes[ 0 ] = (int) sizeof( PCB );
+   header->layoutSizes[ 1 ] = (int) sizeof( IORequest );
+   header->layoutSizes[ 2 ] = (int) sizeof( Device );
+   header->layoutSizes[ 3 ] = (int) sizeof( SimEvent );
+   header->layoutSizes[ 4 ] = (int) sizeof( LatencyStats );
+   header->cpuSchedCode = sim->configDataPtr->cpuSchedCode;
+   header->coreCount = sim->coreCount;
+   header->processCount = sim->processCount;
+   header->opCount = opCount;
+   header->fingerprint = fingerprintRun( sim->configDataPtr, opCodes,
+                                                                  opCount );
+}
+
+/*
+Function name: fingerprintRun
+Algorithm: hashes every config setting that changes how the simulation
+            runs, then the letter, name and value of each op
+Precondition: config data loaded, opCodes from listOpCodes
+Postcondition: returns the fingerprint
+Exceptions: none
+Notes: where a run logs, traces, records or checkpoints to may change
+       between a checkpoint and its restore, so those are left out
+*/
+static unsigned long long fingerprintRun( ConfigDataType* configDataPtr,
+                                          OpCodeType** opCodes, int opCount )
+{
+   const int settings[] = { configDataPtr->cpuSchedCode,
+      configDataPtr->quantumCycles, configDataPtr->memAvailable,
+      configDataPtr->procCycleRate, configDataPtr->ioCycleRate,
+      configDataPtr->hardDriveChannels, configDataPtr->keyboardChannels,
+      configDataPtr->printerChannels, configDataPtr->monitorChannels,
+      configDataPtr->diskSchedCode, configDataPtr->diskCylinders,
+      configDataPtr->diskSeekTimeMs, configDataPtr->intCoalesceCount,
+      configDataPtr->intCoalesceWindowMs, configDataPtr->cpuCores,
+      configDataPtr->mlfqLevels, configDataPtr->mlfqBoostMs,
+      configDataPtr->randomSeed, configDataPtr->arrivalRate,
+      configDataPtr->switchCostCycles, configDataPtr->decisionCostCycles,
+      configDataPtr->warmupCostCycles };
+   unsigned long long hash = FINGERPRINT_BASIS;
+   int index;
+
+   hash = fingerprintAdd( hash, settings, sizeof( settings ) );
+   for( index = 0; index < opCount; index++ )
+   {
+      hash = fingerprintAdd( hash, &opCodes[ index ]->opLtr, 1 );
+      hash = fingerprintAdd( hash, opCodes[ index ]->opName,
+                                 strlen( opCodes[ index ]->opName ) + 1 );
+      hash = fingerprintAdd( hash, &opCodes[ index ]->opValue,
+                                                               sizeof( int ) );
+   }
+
+   return hash;
+}
+
+/*
+Function name: fingerprintAdd
+Algorithm: folds each byte into the hash, FNV-1a
+Precondition: hash from FINGERPRINT_BASIS or an earlier call
+Postcondition: returns the hash with the bytes added
+Exceptions: none
+Notes: none
+*/
+static unsigned long long fingerprintAdd( unsigned long long hash,
+                                          const void* bytes, size_t length )
+{
+   const unsigned char* bytePtr = (const unsigned char*) bytes;
+   size_t index;
+
+   for( index = 0; index < length; index++ )
+   {
+      hash = ( hash ^ bytePtr[ index ] ) * FINGERPRINT_PRIME;
+   }
+
+   return hash;
+}
+
+/*
+Function name: listOpCodes
+Algorithm: collects the meta data nodes in list order
+Precondition: meta data list
+Postcondition: returns the array, opCount set to its length
+Exceptions: none
+Notes: caller frees the array
+*/
+static OpCodeType** listOpCodes( OpCodeType* mdData, int* opCount )
+{
+   OpCodeType* nodePtr;
+   OpCodeType** opCodes;
+   int index = 0;
+
+   *opCount = 0;
+   for( nodePtr = mdData; nodePtr != NULL; nodePtr = nodePtr->next )
+   {
+      ( *opCount )++;
+   }
+
+   opCodes = (OpCodeType**) malloc( sizeof( OpCodeType* )
+                                                      * ( *opCount + 1 ) );
+   for( nodePtr = mdData; nodePtr != NULL; nodePtr = nodePtr->next )
+   {
+      opCodes[ index++ ] = nodePtr;
+   }
+
+   return opCodes;
+}
+
+/*
+Function name: compareOpCodeIndex
+Algorithm: qsort and bsearch comparison of op addresses
+Precondition: two OpCodeIndex pointers
+Postcondition: returns their order by address
+Exceptions: none
+Notes: none
+*/
+static int compareOpCodeIndex( const void* first, const void* second )
+{
+   uintptr_t firstAddress = ( (const OpCodeIndex*) first )->address;
+   uintptr_t secondAddress = ( (const OpCodeIndex*) second )->address;
+
+   return ( firstAddress > secondAddress ) - ( firstAddress < secondAddress );
+}
+
+/*
+Function name: saveState
+Algorithm: writes the header, clock and totals, pending interrupts, PCBs
+            with their program counters as op indices and any I/O request
+            they hold, cores, run queues, calendar, devices with their
+            queues in order, MMU table and the log so far
+Precondition: file open for binary writing
+Postcondition: state written, write errors left on the file
+Exceptions: none
+Notes: program counters are looked up by address in a sorted index of the
+       meta data, so a save is O(ops log ops)
+*/
+static void saveState( EventSimulation* sim, OpCodeType* mdData,
+                                                             FILE* filePtr )
+{
+   CheckpointHeader header;
+   OpCodeType** opCodes;
+   OpCodeIndex* opIndex;
+   OpCodeIndex key;
+   OpCodeIndex* found;
+   IORequest* request;
+   MMU* mmuPtr;
+   LogLinkedList* logPtr;
+   Device* device;
+   PCB* process;
+   int opCount, index, count, lineLength, pcIndex;
+   Boolean hasRequest;
+
+   opCodes = listOpCodes( mdData, &opCount );
+   opIndex = (OpCodeIndex*) malloc( sizeof( OpCodeIndex ) * ( opCount + 1 ) );
+   for( index = 0; index < opCount; index++ )
+   {
+      opIndex[ index ].address = (uintptr_t) opCodes[ index ];
+      opIndex[ index ].index = index;
+   }
+   qsort( opIndex, opCount, sizeof( OpCodeIndex ), compareOpCodeIndex );
+
+   fillHeader( &header, sim, opCodes, opCount );
+   fwrite( &header, sizeof( header ), 1, filePtr );
+
+   //clock, totals and the interrupts held for the next batch
+   fwrite( &sim->clockUs, sizeof( long long ), 1, filePtr );
+   fwrite( &sim->eventCount, sizeof( long long ), 1, filePtr );
+   fwrite( &sim->exitCount, sizeof( int ), 1, filePtr );
+   fwrite( &sim->staggeredArrivals, sizeof( Boolean ), 1, filePtr );
+   fwrite( &sim->pendingCount, sizeof( int ), 1, filePtr );
+   fwrite( &sim->pendingSinceUs, sizeof( long long ), 1, filePtr );
+   fwrite( &sim->interruptStats, sizeof( InterruptStats ), 1, filePtr );
+   fwrite( &sim->deadlineStats, sizeof( DeadlineStats ), 1, filePtr );
+   fwrite( &sim->latencyStats, sizeof( LatencyStats ), 1, filePtr );
+   fwrite( sim->pendingInterrupts, sizeof( int ), sim->pendingCount,
+                                                                  filePtr );
+   fwrite( sim->pendingRaisedUs, sizeof( long long ), sim->pendingCount,
+                                                                  filePtr );
+
+   //processes, their pointers are written as an op index and a flag
+   for( index = 0; index < sim->processCount; index++ )
+   {
+      process = &sim->pcbArray[ index ];
+      pcIndex = -1;
+      if( process->programCounter != NULL )
+      {
+         key.address = (uintptr_t) process->programCounter;
+         found = (OpCodeIndex*) bsearch( &key, opIndex, opCount,
+                              sizeof( OpCodeIndex ), compareOpCodeIndex );
+         pcIndex = found != NULL ? found->index : -1;
+      }
+      hasRequest = process->ioRequest != NULL ? True : False;
+
+      fwrite( process, sizeof( PCB ), 1, filePtr );
+      fwrite( &pcIndex, sizeof( int ), 1, filePtr );
+      fwrite( &hasRequest, sizeof( Boolean ), 1, filePtr );
+      if( hasRequest == True )
+      {
+         fwrite( process->ioRequest, sizeof( IORequest ), 1, filePtr );
+      }
+   }
+
+   //cores and their run queues
+   fwrite( sim->cores, sizeof( SimCore ), sim->coreCount, filePtr );
+   for( index = 0; index < sim->coreCount; index++ )
+   {
+      schedulerSave( &sim->schedulers[ index ], sim->processCount, filePtr );
+   }
+
+   //calendar, in heap order, so it pops in the same order on restore
+   fwrite( &sim->eventQueue.size, sizeof( int ), 1, filePtr );
+   fwrite( &sim->eventQueue.nextSequence, sizeof( long long ), 1, filePtr );
+   fwrite( sim->eventQueue.heap, sizeof( SimEvent ), sim->eventQueue.size,
+                                                                  filePtr );
+
+   //devices, the queue is written as the pIds of its requests
+   fwrite( &sim->deviceTable.startUs, sizeof( long long ), 1, filePtr );
+   for( index = 0; index < DEVICE_COUNT; index++ )
+   {
+      device = &sim->deviceTable.devices[ index ];
+      fwrite( device, sizeof( Device ), 1, filePtr );
+      for( request = device->queueHead; request != NULL;
+                                                   request = request->next )
+      {
+         fwrite( &request->pId, sizeof( int ), 1, filePtr );
+      }
+      fwrite( device->responseUs, sizeof( long long ),
+                                       device->completedCount, filePtr );
+   }
+
+   //MMU table after its head, then the log after its head
+   count = 0;
+   for( mmuPtr = sim->mmuHeadPtr->next; mmuPtr != NULL; mmuPtr = mmuPtr->next )
+   {
+      count++;
+   }
+   fwrite( &count, sizeof( int ), 1, filePtr );
+   for( mmuPtr = sim->mmuHeadPtr->next; mmuPtr != NULL; mmuPtr = mmuPtr->next )
+   {
+      fwrite( &mmuPtr->pId, sizeof( int ), 1, filePtr );
+      fwrite( &mmuPtr->segNumber, sizeof( int ), 1, filePtr );
+      fwrite( &mmuPtr->memBase, sizeof( int ), 1, filePtr );
+      fwrite( &mmuPtr->memOffset, sizeof( int ), 1, filePtr );
+   }
+
+   count = 0;
+   for( logPtr = sim->listHeadPtr->next; logPtr != NULL; logPtr = logPtr->next )
+   {
+      count++;
+   }
+   fwrite( &count, sizeof( int ), 1, filePtr );
+   for( logPtr = sim->listHeadPtr->next; logPtr != NULL; logPtr = logPtr->next )
+   {
+      lineLength = getStringLength( logPtr->logLine );
+      fwrite( &lineLength, sizeof( int ), 1, filePtr );
+      fwrite( logPtr->logLine, sizeof( char ), lineLength, filePtr );
+   }
+
+   free( opIndex );
+   free( opCodes );
+}
+
+/*
+Function name: restorePCBs
+Algorithm: reads each PCB, points its program counter back into the meta
+            data, and rebuilds any I/O request it held
+Precondition: PCBs built by createPCBs, file at the first PCB
+Postcondition: returns True with every PCB as it was saved
+Exceptions: returns False on a short read or an op index out of range
+Notes: pointers are cleared as soon as a PCB is read, so a failed restore
+       never leaves one pointing at garbage
+*/
+static Boolean restorePCBs( EventSimulation* sim, OpCodeType** opCodes,
+                                                int opCount, FILE* filePtr )
+{
+   PCB* process;
+   int index, pcIndex;
+   Boolean hasRequest;
+
+   for( index = 0; index < sim->processCount; index++ )
+   {
+      process = &sim->pcbArray[ index ];
+      if( readItems( filePtr, process, sizeof( PCB ), 1 ) == False )
+      {
+         process->ioRequest = NULL;
+         return False;
+      }
+      process->ioRequest = NULL;
+      process->programCounter = NULL;
+
+      if( readItems( filePtr, &pcIndex, sizeof( int ), 1 ) == False
+            || readItems( filePtr, &hasRequest, sizeof( Boolean ), 1 ) == False
+            || pcIndex >= opCount )
+      {
+         return False;
+      }
+
+      if( pcIndex >= 0 )
+      {
+         process->programCounter = opCodes[ pcIndex ];
+      }
+
+      if( hasRequest == True )
+      {
+         process->ioRequest = (IORequest*) malloc( sizeof( IORequest ) );
+         if( readItems( filePtr, process->ioRequest, sizeof( IORequest ), 1 )
+                                                                     == False )
+         {
+            free( process->ioRequest );
+            process->ioRequest = NULL;
+            return False;
+         }
+         process->ioRequest->next = NULL;
+      }
+   }
+
+   return True;
+}
+
+/*
+Function name: restoreDevice
+Algorithm: reads the device over the one deviceTableInit built, keeping its
+            own lock and response array, then links its queue back up from
+            the requests held by the queued processes
+Precondition: device from deviceTableInit, PCBs already restored
+Postcondition: returns True with the device as it was saved
+Exceptions: returns False on a short read, or a queued pId without a request
+Notes: none
+*/
+static Boolean restoreDevice( EventSimulation* sim, Device* device,
+                                                             FILE* filePtr )
+{
+   long long* responseUs = device->responseUs;
+   IORequest* request;
+   Boolean intact;
+   int index, pId;
+
+   pthread_mutex_destroy( &device->lock );
+   pthread_cond_destroy( &device->grantCond );
+   intact = readItems( filePtr, device, sizeof( Device ), 1 );
+   pthread_mutex_init( &device->lock, NULL );
+   pthread_cond_init( &device->grantCond, NULL );
+
+   device->responseUs = responseUs;
+   device->queueHead = NULL;
+   device->queueTail = NULL;
+   if( intact == False || device->queueLength < 0
+         || device->completedCount < 0
+         || device->responseCapacity < device->completedCount
+         || device->responseCapacity < 1 )
+   {
+      device->queueLength = 0;
+      return False;
+   }
+
+   //the queue, oldest request first
+   for( index = 0; index < device->queueLength; index++ )
+   {
+      if( readItems( filePtr, &pId, sizeof( int ), 1 ) == False
+            || pId < 0 || pId >= sim->processCount
+            || sim->pcbArray[ pId ].ioRequest == NULL )
+      {
+         device->queueLength = index;
+         return False;
+      }
+
+      request = sim->pcbArray[ pId ].ioRequest;
+      if( device->queueTail == NULL )
+      {
+         device->queueHead = request;
+      }
+      else
+      {
+         device->queueTail->next = request;
+      }
+      device->queueTail = request;
+   }
+
+   device->responseUs = (long long*) realloc( device->responseUs,
+                           sizeof( long long ) * device->responseCapacity );
+   return readItems( filePtr, device->responseUs, sizeof( long long ),
+                                                   device->completedCount );
+}
+
+/*
+Function name: restoreLists
+Algorithm: appends the saved MMU entries after the MMU head, and the saved
+            log lines after the log head
+Precondition: both lists hold only their head node
+Postcondition: returns True with both lists as they were saved
+Exceptions: returns False on a short read or a bad count or length
+Notes: the log's cached tail is kept up, so logging carries on after it
+*/
+static Boolean restoreLists( EventSimulation* sim, FILE* filePtr )
+{
+   LogLinkedList* logNewPtr;
+   MMU* mmuTailPtr = sim->mmuHeadPtr;
+   MMU* mmuNewPtr;
+   int count, index, lineLength;
+
+   if( readItems( filePtr, &count, sizeof( int ), 1 ) == False || count < 0 )
+   {
+      return False;
+   }
+
+   for( index = 0; index < count; index++ )
+   {
+      mmuNewPtr = (MMU*) malloc( sizeof( MMU ) );
+      mmuNewPtr->next = NULL;
+      mmuTailPtr->next = mmuNewPtr;
+      mmuTailPtr = mmuNewPtr;
+
+      if( readItems( filePtr, &mmuNewPtr->pId, sizeof( int ), 1 ) == False
+         || readItems( filePtr, &mmuNewPtr->segNumber, sizeof( int ), 1 )
+                                                                     == False
+         || readItems( filePtr, &mmuNewPtr->memBase, sizeof( int ), 1 )
+                                                                     == False
+         || readItems( filePtr, &mmuNewPtr->memOffset, sizeof( int ), 1 )
+                                                                     == False )
+      {
+         return False;
+      }
+   }
+
+   if( readItems( filePtr, &count, sizeof( int ), 1 ) == False || count < 0 )
+   {
+      return False;
+   }
+
+   for( index = 0; index < count; index++ )
+   {
+      if( readItems( filePtr, &lineLength, sizeof( int ), 1 ) == False
+                                                         || lineLength < 0 )
+      {
+         return False;
+      }
+
+      //sized to the line, as createLogNode sizes it
+      logNewPtr = (LogLinkedList*) malloc( sizeof( LogLinkedList )
+                                                            + lineLength + 1 );
+      logNewPtr->next = NULL;
+      logNewPtr->tail = NULL;
+      logNewPtr->logLine[ lineLength ] = NULL_CHAR;
+      appendNodeLL( sim->listHeadPtr, logNewPtr );
+
+      if( readItems( filePtr, logNewPtr->logLine, sizeof( char ), lineLength )
+                                                                     == False )
+      {
+         return False;
+      }
+   }
+
+   return True;
+}
+
+/*
+Function name: readItems
+Algorithm: reads count items of itemSize
+Precondition: file open for binary reading
+Postcondition: returns True when every item was read
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean readItems( FILE* filePtr, void* items, size_t itemSize,
+                                                                size_t count )
+{
+   return fread( items, itemSize, count, filePtr ) == count ? True : False;
+}
@@ -12,11 +12,12 @@
  */
 
 #include "ConfigAccess.h"
+#include "Scheduler.h"
 
 /*
 Function name: getConfigData
-Algorithm: opens file, acquires configuration data,
-           returns pointer to data structure
+Algorithm: opens file, reads its configuration data through readConfigData,
+           closes file
 Precondition: for correct operation, file is available, is formatted correctly,
               and has all configuration lines and data although
               the configuration lines are not required to be
@@ -25,32 +26,17 @@ Postcondition: in correct operation,
                returns pointer to correct configuration data structure
 Exceptions: correct and appropriately (without program failure)
             responds to and reports file access failure,
-            incorrectly formatted lead or end descriptors,
-            incorrectly formatted prompt, data out of range,
-            and incomplete file conditons
+            and every error readConfigData reports
 Notes: none
 */
 
 int getConfigData( char *fileName, ConfigDataType **configData )
 {
-
-   // set constant number of data lines to 9
-   const int NUM_DATA_LINES = 9;
-
-   // set line counter to zero
-   int lineCtr = 0;
-
    // set read only constant to "r"
    const char READ_ONLY_FLAG[] = "r";
 
-   // create pointer for data input
-   ConfigDataType *tempData;
-
-   // declare other variables
    FILE *fileAccessPtr;
-   char dataBuffer[ MAX_STR_LEN ];
-   int intData, dataLineCode;
-   double doubleData;
+   int accessResult;
 
    // initialize config data pointer in case of return error
    *configData = NULL;
@@ -64,34 +50,95 @@ int getConfigData( char *fileName, ConfigDataType **configData )
       return CFG_FILE_ACCESS_ERR;
    }
 
+   accessResult = readConfigData( fileAccessPtr, configData );
+
+   // close file access
+   fclose( fileAccessPtr );
+
+   return accessResult;
+}
+
+/*
+Function name: readConfigData
+Algorithm: acquires configuration data from an open stream,
+           returns pointer to data structure
+Precondition: for correct operation, stream is open at its start,
+              is formatted correctly,
+              and has all configuration lines and data although
+              the configuration lines are not required to be
+              in a specific order
+Postcondition: in correct operation,
+               returns pointer to correct configuration data structure
+Exceptions: correct and appropriately (without program failure)
+            responds to and reports incorrectly formatted lead
+            or end descriptors,
+            incorrectly formatted prompt, data out of range,
+            and incomplete file conditons
+Notes: the stream is left open for the caller to close; a memory stream
+       reads the same as a file
+*/
+
+int readConfigData( FILE *fileAccessPtr, ConfigDataType **configData )
+{
+
+   // set constant number of required data lines to 9
+   const int NUM_DATA_LINES = 9;
+
+   // set line counter to zero, counts required lines only
+   int lineCtr = 0;
+
+   // file position of the current line leader, used to rewind on end line
+   long linePosition;
+
+   // create pointer for data input
+   ConfigDataType *tempData;
+
+   // declare other variables
+   char dataBuffer[ MAX_STR_LEN ];
+   int intData, dataLineCode, accessResult;
+   double doubleData;
+
+   // initialize config data pointer in case of return error
+   *configData = NULL;
+
    // get first line, check for failure
    if( getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
                       dataBuffer, IGNORE_LEADING_WS ) != NO_ERR 
         || compareString( dataBuffer, "Start Simulator Configuration File" )
                                                                    != STR_EQ )
    {
-      // close file access
-      fclose( fileAccessPtr );
-
       return CFG_CORRUPT_DESCRIPTOR_ERR;
    }
 
    // create temporary pointer to configuration data structure
    tempData = (ConfigDataType *) malloc( sizeof( ConfigDataType ) );
 
-   // loop to end of config data items
-   while( lineCtr < NUM_DATA_LINES )
+   // optional lines may be left out, so give them their default values
+   setConfigDefaults( tempData );
+
+   // loop to end of config data items, required and optional
+   while( True )
    {
-      // get line leader, check for failure
-      if( getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
-                           dataBuffer, IGNORE_LEADING_WS ) != NO_ERR )
+      // remember where this leader starts, in case it is the end descriptor
+      linePosition = ftell( fileAccessPtr );
+
+      // get line leader, stop at end descriptor, check for failure
+      accessResult = getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
+                                            dataBuffer, IGNORE_LEADING_WS );
+
+      if( findSubString( dataBuffer, "End Simulator Configuration File" )
+                                                                        == 0 )
+      {
+         // rewind so the end descriptor check below reads the whole line
+         fseek( fileAccessPtr, linePosition, SEEK_SET );
+         break;
+      }
+
+      if( accessResult != NO_ERR )
       {
          // free temp struct memory
          free( tempData );
 
-         // close file access
-         fclose( fileAccessPtr );
-         
          return INCOMPLETE_FILE_ERR;
       }
 
@@ -113,7 +160,13 @@ int getConfigData( char *fileName, ConfigDataType **configData )
          else if( dataLineCode == CFG_MD_FILE_NAME_CODE
                      || dataLineCode == CFG_LOG_FILE_NAME_CODE
                            || dataLineCode == CFG_CPU_SCHED_CODE
-                              || dataLineCode == CFG_LOG_TO_CODE )
+                              || dataLineCode == CFG_LOG_TO_CODE
+                                 || dataLineCode == CFG_SIM_CLOCK_CODE
+                                    || dataLineCode == CFG_DISK_SCHED_CODE
+                                 || dataLineCode == CFG_TRACE_FILE_NAME_CODE
+                           || dataLineCode == CFG_CHECKPOINT_FILE_NAME_CODE
+                              || dataLineCode == CFG_RECORD_FILE_NAME_CODE
+                                 || dataLineCode == CFG_METRICS_SOCKET_CODE )
          {
             // get string input
             fscanf( fileAccessPtr, "%s", dataBuffer );
@@ -185,6 +238,112 @@ int getConfigData( char *fileName, ConfigDataType **configData )
                   // assign log to file name using string data
                   copyString( tempData->logToFileName, dataBuffer );
                   break;
+
+               // case simulation clock code (optional)
+               case CFG_SIM_CLOCK_CODE:
+                  // assign code using string data converted to clock code
+                  tempData->simClockCode = getSimClockCode( dataBuffer );
+                  break;
+
+               // case device channel codes (optional)
+               case CFG_HARD_DRIVE_CHANNELS_CODE:
+                  tempData->hardDriveChannels = intData;
+                  break;
+
+               case CFG_KEYBOARD_CHANNELS_CODE:
+                  tempData->keyboardChannels = intData;
+                  break;
+
+               case CFG_PRINTER_CHANNELS_CODE:
+                  tempData->printerChannels = intData;
+                  break;
+
+               case CFG_MONITOR_CHANNELS_CODE:
+                  tempData->monitorChannels = intData;
+                  break;
+
+               // case disk scheduling codes (optional)
+               case CFG_DISK_SCHED_CODE:
+                  tempData->diskSchedCode = getDiskSchedCode( dataBuffer );
+                  break;
+
+               case CFG_DISK_CYLINDERS_CODE:
+                  tempData->diskCylinders = intData;
+                  break;
+
+               case CFG_DISK_SEEK_TIME_CODE:
+                  tempData->diskSeekTimeMs = intData;
+                  break;
+
+               // case interrupt coalescing codes (optional)
+               case CFG_INT_COALESCE_COUNT_CODE:
+                  tempData->intCoalesceCount = intData;
+                  break;
+
+               case CFG_INT_COALESCE_WINDOW_CODE:
+                  tempData->intCoalesceWindowMs = intData;
+                  break;
+
+               // case CPU cores code (optional)
+               case CFG_CPU_CORES_CODE:
+                  tempData->cpuCores = intData;
+                  break;
+
+               // case MLFQ codes (optional)
+               case CFG_MLFQ_LEVELS_CODE:
+                  tempData->mlfqLevels = intData;
+                  break;
+
+               case CFG_MLFQ_BOOST_CODE:
+                  tempData->mlfqBoostMs = intData;
+                  break;
+
+               // case random seed code (optional)
+               case CFG_RANDOM_SEED_CODE:
+                  tempData->randomSeed = intData;
+                  break;
+
+               // case arrival rate code (optional)
+               case CFG_ARRIVAL_RATE_CODE:
+                  tempData->arrivalRate = intData;
+                  break;
+
+               // case dispatch overhead codes (optional)
+               case CFG_SWITCH_COST_CODE:
+                  tempData->switchCostCycles = intData;
+                  break;
+
+               case CFG_DECISION_COST_CODE:
+                  tempData->decisionCostCycles = intData;
+                  break;
+
+               case CFG_WARMUP_COST_CODE:
+                  tempData->warmupCostCycles = intData;
+                  break;
+
+               // case trace file name code (optional)
+               case CFG_TRACE_FILE_NAME_CODE:
+                  copyString( tempData->traceFileName, dataBuffer );
+                  break;
+
+               // case checkpoint codes (optional)
+               case CFG_CHECKPOINT_FILE_NAME_CODE:
+                  copyString( tempData->checkpointFileName, dataBuffer );
+                  break;
+
+               case CFG_CHECKPOINT_INTERVAL_CODE:
+                  tempData->checkpointIntervalMs = intData;
+                  break;
+
+               // case interrupt record file name code (optional)
+               case CFG_RECORD_FILE_NAME_CODE:
+                  copyString( tempData->recordFileName, dataBuffer );
+                  break;
+
+               // case metrics socket path code (optional)
+               case CFG_METRICS_SOCKET_CODE:
+                  copyString( tempData->metricsSocketName, dataBuffer );
+                  break;
             }
          }
 
@@ -194,9 +353,6 @@ int getConfigData( char *fileName, ConfigDataType **configData )
             // free temp struct memroy
             free( tempData );
 
-            // close file access
-            fclose( fileAccessPtr );
-
             return CFG_DATA_OUT_OF_RANGE_ERR;
          }
       }
@@ -207,13 +363,23 @@ int getConfigData( char *fileName, ConfigDataType **configData )
          // free temp struct memory
          free( tempData );
 
-         // close file access
-         fclose( fileAccessPtr );
-         
          return CFG_CORRUPT_PROMPT_ERR;
       }
 
-      lineCtr++;
+      // only the original nine lines count towards a complete file
+      if( dataLineCode <= CFG_LOG_FILE_NAME_CODE )
+      {
+         lineCtr++;
+      }
+   }
+
+   // check that every required line was found before the end descriptor
+   if( lineCtr < NUM_DATA_LINES )
+   {
+      // free temp struct memory
+      free( tempData );
+
+      return INCOMPLETE_FILE_ERR;
    }
    
    // acquire end of sim config string
@@ -225,18 +391,12 @@ int getConfigData( char *fileName, ConfigDataType **configData )
       // free temp struct memory
       free ( tempData );
 
-      // close file access
-      fclose( fileAccessPtr );
-
       return CFG_CORRUPT_DESCRIPTOR_ERR;
    }
 
    // assign temporary pointer to parameter return pointer
    *configData = tempData;
 
-   // close file access
-   fclose( fileAccessPtr );
-
    // return no error code
 	return NO_ERR;
 }
@@ -312,6 +472,133 @@ int getDataLineCode( char *dataBuffer )
       return CFG_LOG_FILE_NAME_CODE;
    }
 
+   // check for simulation clock string (optional)
+   if( compareString( dataBuffer, "Simulation Clock" ) == STR_EQ )
+   {
+      return CFG_SIM_CLOCK_CODE;
+   }
+
+   // check for device channel strings (optional)
+   if( compareString( dataBuffer, "Hard Drive Channels" ) == STR_EQ )
+   {
+      return CFG_HARD_DRIVE_CHANNELS_CODE;
+   }
+
+   if( compareString( dataBuffer, "Keyboard Channels" ) == STR_EQ )
+   {
+      return CFG_KEYBOARD_CHANNELS_CODE;
+   }
+
+   if( compareString( dataBuffer, "Printer Channels" ) == STR_EQ )
+   {
+      return CFG_PRINTER_CHANNELS_CODE;
+   }
+
+   if( compareString( dataBuffer, "Monitor Channels" ) == STR_EQ )
+   {
+      return CFG_MONITOR_CHANNELS_CODE;
+   }
+
+   // check for disk model strings (optional)
+   if( compareString( dataBuffer, "Disk Scheduling Code" ) == STR_EQ )
+   {
+      return CFG_DISK_SCHED_CODE;
+   }
+
+   if( compareString( dataBuffer, "Disk Cylinders" ) == STR_EQ )
+   {
+      return CFG_DISK_CYLINDERS_CODE;
+   }
+
+   if( compareString( dataBuffer, "Disk Seek Time (msec)" ) == STR_EQ )
+   {
+      return CFG_DISK_SEEK_TIME_CODE;
+   }
+
+   // check for interrupt coalescing strings (optional)
+   if( compareString( dataBuffer, "Interrupt Coalesce Count" ) == STR_EQ )
+   {
+      return CFG_INT_COALESCE_COUNT_CODE;
+   }
+
+   if( compareString( dataBuffer, "Interrupt Coalesce Window (msec)" )
+                                                                     == STR_EQ )
+   {
+      return CFG_INT_COALESCE_WINDOW_CODE;
+   }
+
+   // check for CPU cores string (optional)
+   if( compareString( dataBuffer, "CPU Cores" ) == STR_EQ )
+   {
+      return CFG_CPU_CORES_CODE;
+   }
+
+   // check for MLFQ strings (optional)
+   if( compareString( dataBuffer, "MLFQ Levels" ) == STR_EQ )
+   {
+      return CFG_MLFQ_LEVELS_CODE;
+   }
+
+   if( compareString( dataBuffer, "MLFQ Boost Interval (msec)" ) == STR_EQ )
+   {
+      return CFG_MLFQ_BOOST_CODE;
+   }
+
+   // check for random seed string (optional)
+   if( compareString( dataBuffer, "Random Seed" ) == STR_EQ )
+   {
+      return CFG_RANDOM_SEED_CODE;
+   }
+
+   // check for arrival rate string (optional)
+   if( compareString( dataBuffer, "Arrival Rate (per sec)" ) == STR_EQ )
+   {
+      return CFG_ARRIVAL_RATE_CODE;
+   }
+
+   // check for dispatch overhead strings (optional)
+   if( compareString( dataBuffer, "Context Switch Cost (cycles)" ) == STR_EQ )
+   {
+      return CFG_SWITCH_COST_CODE;
+   }
+
+   if( compareString( dataBuffer, "Scheduler Decision Cost (cycles)" )
+                                                                     == STR_EQ )
+   {
+      return CFG_DECISION_COST_CODE;
+   }
+
+   if( compareString( dataBuffer, "Cache Warmup Penalty (cycles)" ) == STR_EQ )
+   {
+      return CFG_WARMUP_COST_CODE;
+   }
+
+   if( compareString( dataBuffer, "Trace File Path" ) == STR_EQ )
+   {
+      return CFG_TRACE_FILE_NAME_CODE;
+   }
+
+   // check for checkpoint strings (optional)
+   if( compareString( dataBuffer, "Checkpoint File Path" ) == STR_EQ )
+   {
+      return CFG_CHECKPOINT_FILE_NAME_CODE;
+   }
+
+   if( compareString( dataBuffer, "Checkpoint Interval (msec)" ) == STR_EQ )
+   {
+      return CFG_CHECKPOINT_INTERVAL_CODE;
+   }
+
+   if( compareString( dataBuffer, "Interrupt Record File Path" ) == STR_EQ )
+   {
+      return CFG_RECORD_FILE_NAME_CODE;
+   }
+
+   if( compareString( dataBuffer, "Metrics Socket Path" ) == STR_EQ )
+   {
+      return CFG_METRICS_SOCKET_CODE;
+   }
+
     // at this point, assume failed string access, return correct prompt error
     return CFG_CORRUPT_PROMPT_ERR;
 }
@@ -319,52 +606,24 @@ int getDataLineCode( char *dataBuffer )
 /*
 Function name: getCpuSchedCode
 Algorithm: converts string data (e.g., "SJF-N", "SRTF-P")
-           to constant code number to be stored as integer
+           to the code of its policy in the scheduler registry
 Precondtion: codeStr is a valid C-style string with one
              of the specified cpu scheduling operations
 Postcondition: returns error code representing scheduling actions
 Exceptions: defaults to fcfs code
 Notes: none
 */
-ConfigDataCodes getCpuSchedCode( char *codeStr )
+int getCpuSchedCode( char *codeStr )
 {
-   // set up temporary string for testing
-   int strLen = getStringLength( codeStr );
-   char *tempStr = (char *) malloc( strLen + 1 );
-
-   // set default return to FSFC-N
-   int returnVal = CPU_SCHED_FCFS_N_CODE;
-
-   // set string to lower case for testing
-   setStrToLowerCase( tempStr, codeStr );
-
-   // check for SJF-N
-   if( compareString( tempStr, "sjf-n" ) == STR_EQ )
-   {
-      returnVal = CPU_SCHED_SJF_N_CODE;
-   }
+   // look the name up in the scheduler registry
+   int returnVal = findSchedulerCode( codeStr );
 
-   // check for SRTF-P
-   else if( compareString( tempStr, "srtf-p" ) == STR_EQ )
+   // set default return to FSFC-N, for "none"
+   if( returnVal < 0 )
    {
-      returnVal = CPU_SCHED_SRTF_P_CODE;
+      returnVal = CPU_SCHED_FCFS_N_CODE;
    }
 
-   // check for FCFS-P
-   else if( compareString( tempStr, "fcfs-p" ) == STR_EQ )
-   {
-      returnVal = CPU_SCHED_FCFS_P_CODE;
-   }
-
-   // check for RR-P
-   else if( compareString( tempStr, "rr-p" ) == STR_EQ )
-   {
-      returnVal = CPU_SCHED_RR_P_CODE;
-   }
-
-   // free temp string memory
-   free( tempStr );
-
    // return code found
    return returnVal;
 }
@@ -409,13 +668,9 @@ Boolean valueInRange( int lineCode, int intVal,
          tempStr = (char *) malloc( strLen + 1 );
          setStrToLowerCase( tempStr, stringVal );
 
-         // check for not finding one of the scheduling strings 
+         // check for not finding one of the registered scheduling policies
          if( compareString( tempStr, "none" ) != STR_EQ
-               && compareString( tempStr, "fcfs-n" ) != STR_EQ
-               && compareString( tempStr, "sjf-n" ) != STR_EQ
-               && compareString( tempStr, "srtf-p" ) != STR_EQ
-               && compareString( tempStr, "fcfs-p" ) != STR_EQ
-               && compareString( tempStr, "rr-p" ) != STR_EQ )
+               && findSchedulerCode( tempStr ) < 0 )
          {
             result = False;
          }
@@ -469,7 +724,147 @@ Boolean valueInRange( int lineCode, int intVal,
          // check for not finding one of the log to strings
          if( compareString( tempStr, "both" ) != STR_EQ
              && compareString( tempStr, "monitor" ) != STR_EQ
-             && compareString( tempStr, "file" ) != STR_EQ )
+             && compareString( tempStr, "file" ) != STR_EQ
+             && compareString( tempStr, "none" ) != STR_EQ )
+         {
+            result = False;
+         }
+
+         // free temp string memory
+         free( tempStr );
+
+         break;
+
+      // for device channels, zero leaves the device unlimited
+      case CFG_HARD_DRIVE_CHANNELS_CODE:
+      case CFG_KEYBOARD_CHANNELS_CODE:
+      case CFG_PRINTER_CHANNELS_CODE:
+      case CFG_MONITOR_CHANNELS_CODE:
+         if( intVal < 0 || intVal > 100 )
+         {
+            result = False;
+         }
+         break;
+
+      // for disk scheduling code
+      case CFG_DISK_SCHED_CODE:
+         // create temporary string and set to lower case
+         strLen = getStringLength( stringVal );
+         tempStr = (char *) malloc( strLen + 1 );
+         setStrToLowerCase( tempStr, stringVal );
+
+         // check for not finding one of the disk scheduling strings
+         if( compareString( tempStr, "fcfs" ) != STR_EQ
+             && compareString( tempStr, "sstf" ) != STR_EQ
+             && compareString( tempStr, "scan" ) != STR_EQ
+             && compareString( tempStr, "c-look" ) != STR_EQ )
+         {
+            result = False;
+         }
+
+         free( tempStr );
+         break;
+
+      // for disk cylinders
+      case CFG_DISK_CYLINDERS_CODE:
+         if( intVal < 1 || intVal > 100000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for full stroke seek time
+      case CFG_DISK_SEEK_TIME_CODE:
+         if( intVal < 0 || intVal > 1000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for interrupts serviced per batch
+      case CFG_INT_COALESCE_COUNT_CODE:
+         if( intVal < 1 || intVal > 10000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for longest an interrupt may wait for its batch
+      case CFG_INT_COALESCE_WINDOW_CODE:
+         if( intVal < 0 || intVal > 10000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for simulated CPU cores
+      case CFG_CPU_CORES_CODE:
+         if( intVal < 1 || intVal > MAX_CPU_CORES )
+         {
+            result = False;
+         }
+         break;
+
+      // for MLFQ priority levels, the lowest level's quantum doubles per level
+      case CFG_MLFQ_LEVELS_CODE:
+         if( intVal < 1 || intVal > MAX_MLFQ_LEVELS )
+         {
+            result = False;
+         }
+         break;
+
+      // for CPU time between MLFQ priority boosts, 0 for never
+      case CFG_MLFQ_BOOST_CODE:
+         if( intVal < 0 || intVal > 1000000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for the seed of every random draw, so runs can be repeated
+      case CFG_RANDOM_SEED_CODE:
+         if( intVal < 0 )
+         {
+            result = False;
+         }
+         break;
+
+      // for Poisson process arrivals, 0 for every process at time zero
+      case CFG_ARRIVAL_RATE_CODE:
+         if( intVal < 0 || intVal > 1000000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for processor cycles lost to a dispatch, 0 for none
+      case CFG_SWITCH_COST_CODE:
+      case CFG_DECISION_COST_CODE:
+      case CFG_WARMUP_COST_CODE:
+         if( intVal < 0 || intVal > 10000 )
+         {
+            result = False;
+         }
+         break;
+
+      // for simulated time between checkpoints, 0 for only on request
+      case CFG_CHECKPOINT_INTERVAL_CODE:
+         if( intVal < 0 )
+         {
+            result = False;
+         }
+         break;
+
+      // for simulation clock
+      case CFG_SIM_CLOCK_CODE:
+         // create temporary string and set to lower case
+         strLen = getStringLength( stringVal );
+         tempStr = (char *) malloc( strLen + 1 );
+         setStrToLowerCase( tempStr, stringVal );
+
+         // check for not finding one of the clock strings
+         if( compareString( tempStr, "real" ) != STR_EQ
+             && compareString( tempStr, "virtual" ) != STR_EQ )
          {
             result = False;
          }
@@ -519,6 +914,47 @@ ConfigDataCodes getLogToCode( char *logToStr )
       returnVal = LOGTO_FILE_CODE;
    }
 
+   // check for NONE, a silent run that keeps no log
+   if( compareString( tempStr, "none" ) == STR_EQ )
+   {
+      returnVal = LOGTO_NONE_CODE;
+   }
+
+   // free temp string memory
+   free( tempStr );
+
+   // return code found
+   return returnVal;
+}
+
+/*
+Function name: getSimClockCode
+Algorithm: converts string data (e.g., "Real", "Virtual")
+           to constant code number to be stored as integer
+Precondtion: clockStr is a C-style string with one
+             of the specified clock modes
+Postcondtion: returns code representing the simulation clock
+Exceptions: defaults to real clock code
+Notes: none
+*/
+ConfigDataCodes getSimClockCode( char *clockStr )
+{
+   // create temporary string
+   int strLen = getStringLength( clockStr );
+   char *tempStr = (char *) malloc( strLen + 1 );
+
+   // set default return value to the real (wall) clock
+   int returnVal = SIM_CLOCK_REAL_CODE;
+
+   // set temp string to lower case
+   setStrToLowerCase( tempStr, clockStr );
+
+   // check for VIRTUAL
+   if( compareString( tempStr, "virtual" ) == STR_EQ )
+   {
+      returnVal = SIM_CLOCK_VIRTUAL_CODE;
+   }
+
    // free temp string memory
    free( tempStr );
 
@@ -526,6 +962,118 @@ ConfigDataCodes getLogToCode( char *logToStr )
    return returnVal;
 }
 
+/*
+Function name: getDiskSchedCode
+Algorithm: converts string data (e.g., "SSTF", "C-LOOK")
+           to constant code number to be stored as integer
+Precondtion: codeStr is a C-style string with one
+             of the specified disk scheduling operations
+Postcondtion: returns code representing the disk scheduling
+Exceptions: defaults to fcfs code
+Notes: none
+*/
+ConfigDataCodes getDiskSchedCode( char *codeStr )
+{
+   // create temporary string
+   int strLen = getStringLength( codeStr );
+   char *tempStr = (char *) malloc( strLen + 1 );
+
+   // set default return value to first come first serve
+   int returnVal = DISK_SCHED_FCFS_CODE;
+
+   // set temp string to lower case
+   setStrToLowerCase( tempStr, codeStr );
+
+   // check for SSTF
+   if( compareString( tempStr, "sstf" ) == STR_EQ )
+   {
+      returnVal = DISK_SCHED_SSTF_CODE;
+   }
+
+   // check for SCAN
+   else if( compareString( tempStr, "scan" ) == STR_EQ )
+   {
+      returnVal = DISK_SCHED_SCAN_CODE;
+   }
+
+   // check for C-LOOK
+   else if( compareString( tempStr, "c-look" ) == STR_EQ )
+   {
+      returnVal = DISK_SCHED_CLOOK_CODE;
+   }
+
+   // free temp string memory
+   free( tempStr );
+
+   // return code found
+   return returnVal;
+}
+
+/*
+Function name: setConfigDefaults
+Algorithm: assigns default values to every optional configuration item
+Precondition: configData points to allocated config data
+Postcondition: optional items hold their defaults, required items untouched
+Exceptions: none
+Notes: defaults reproduce the behaviour of files without optional lines
+*/
+void setConfigDefaults( ConfigDataType *configData )
+{
+   configData->simClockCode = SIM_CLOCK_REAL_CODE;
+
+   // zero channels, every I/O op is serviced independently
+   configData->hardDriveChannels = 0;
+   configData->keyboardChannels = 0;
+   configData->printerChannels = 0;
+   configData->monitorChannels = 0;
+
+   // first come first serve disk, with no seek time modelled
+   configData->diskSchedCode = DISK_SCHED_FCFS_CODE;
+   configData->diskCylinders = 200;
+   configData->diskSeekTimeMs = 0;
+
+   // every interrupt serviced as soon as it is raised
+   configData->intCoalesceCount = 1;
+   configData->intCoalesceWindowMs = 0;
+
+   // a single CPU, as the simulator has always modelled
+   configData->cpuCores = 1;
+
+   // three MLFQ levels, boosted after every second of CPU time
+   configData->mlfqLevels = 3;
+   configData->mlfqBoostMs = 1000;
+
+   // a fixed seed, so runs repeat unless asked otherwise
+   configData->randomSeed = 1;
+
+   // every process without an arrival op arrives at time zero
+   configData->arrivalRate = 0;
+
+   // dispatches are free, as the simulator has always modelled
+   configData->switchCostCycles = 0;
+   configData->decisionCostCycles = 0;
+   configData->warmupCostCycles = 0;
+
+   // no trace, only the log and summary are written
+   configData->traceFileName[ 0 ] = NULL_CHAR;
+
+   // no checkpoints, a run can only start from the beginning
+   configData->checkpointFileName[ 0 ] = NULL_CHAR;
+   configData->checkpointIntervalMs = 0;
+
+   // interrupts are not recorded
+   configData->recordFileName[ 0 ] = NULL_CHAR;
+
+   // no metrics socket, a run is only seen through its log
+   configData->metricsSocketName[ 0 ] = NULL_CHAR;
+
+   // no embedding program is listening
+   configData->eventCallback = NULL;
+   configData->eventUserData = NULL;
+   configData->restoreFileName[ 0 ] = NULL_CHAR;
+   configData->replayFileName[ 0 ] = NULL_CHAR;
+}
+
 /*
 Function name: displayConfigData
 Algorithm: diagnostic function to show config data output
@@ -543,8 +1091,8 @@ void displayConfigData( ConfigDataType *configData )
    printf( "===================\n" );
    printf( "Version                : %3.2f\n", configData->version );
    printf( "Program File Name      : %s\n", configData->metaDataFileName );
-   configCodeToString( configData->cpuSchedCode, displayString );
-   printf( "CPU schedule selection : %s\n", displayString );
+   printf( "CPU schedule selection : %s\n",
+                           getSchedulerPolicy( configData->cpuSchedCode )->name );
    printf( "Quantum time           : %d\n", configData->quantumCycles );
    printf( "Memory Available       : %d\n", configData->memAvailable );
    printf( "Process cycle rate     : %d\n", configData-> procCycleRate );
@@ -552,14 +1100,47 @@ void displayConfigData( ConfigDataType *configData )
    configCodeToString( configData->logToCode, displayString );
    printf( "Log to selection       : %s\n", displayString );
    printf( "Log file name          : %s\n", configData->logToFileName );
+   configCodeToString( configData->simClockCode, displayString );
+   printf( "Simulation clock       : %s\n", displayString );
+   printf( "Device channels        : %d/%d/%d/%d\n",
+                     configData->hardDriveChannels, configData->keyboardChannels,
+                     configData->printerChannels, configData->monitorChannels );
+   configCodeToString( configData->diskSchedCode, displayString );
+   printf( "Disk scheduling        : %s, %d cylinders, %d ms seek\n",
+                                       displayString, configData->diskCylinders,
+                                                   configData->diskSeekTimeMs );
+   printf( "Interrupt coalescing   : %d per batch, %d ms window\n",
+                                             configData->intCoalesceCount,
+                                             configData->intCoalesceWindowMs );
+   printf( "CPU cores              : %d\n", configData->cpuCores );
+   printf( "MLFQ                   : %d levels, %d ms boost interval\n",
+                           configData->mlfqLevels, configData->mlfqBoostMs );
+   printf( "Random seed            : %d\n", configData->randomSeed );
+   printf( "Arrival rate           : %d per sec\n", configData->arrivalRate );
+   printf( "Dispatch overhead      : %d switch, %d decision, %d warmup cycles\n",
+                  configData->switchCostCycles, configData->decisionCostCycles,
+                                             configData->warmupCostCycles );
+   printf( "Trace file name        : %s\n",
+            configData->traceFileName[ 0 ] == NULL_CHAR ? "none"
+                                                : configData->traceFileName );
+   printf( "Checkpoint file name   : %s, every %d ms\n",
+            configData->checkpointFileName[ 0 ] == NULL_CHAR ? "none"
+                                          : configData->checkpointFileName,
+                                          configData->checkpointIntervalMs );
+   printf( "Interrupt record file  : %s\n",
+            configData->recordFileName[ 0 ] == NULL_CHAR ? "none"
+                                                : configData->recordFileName );
+   printf( "Metrics socket         : %s\n",
+            configData->metricsSocketName[ 0 ] == NULL_CHAR ? "none"
+                                             : configData->metricsSocketName );
 }
 
 /*
 Function name: configCodeToString
 Algorithm: utility function to support display
-           of CPU scheduling or Log To code strings
+           of Log To, clock or disk scheduling code strings
 Precondition: code variable holds constant value from ConfigDataCodes
-              for item (e.g., CPU_SCHED_SRTF_P, LOGTO_FILE_CODE, etc.)
+              for item (e.g., LOGTO_FILE_CODE, SIM_CLOCK_REAL_CODE, etc.)
 Postcondition: string parameter holds correct string
                associated with the given constant
 Exceptions: none
@@ -567,10 +1148,11 @@ Notes: none
 */
 void configCodeToString( int code, char *outString )
 {
-   // Define array with eight items, and short (10) lengths
-   char displayStrings[ 8 ][ 10 ] = { "SJF-P", "SRTF-P", "FCFS-P",
-                                       "RR-P", "FCFS-N", "Monitor",
-                                       "File", "Both" };
+   // Define array with ten items, and short (10) lengths
+   // NOTE: CPU scheduling codes are named by their scheduler policy
+   char displayStrings[ 10 ][ 10 ] = { "Monitor", "File", "Both",
+                                       "Real", "Virtual", "FCFS", "SSTF",
+                                       "SCAN", "C-LOOK", "None" };
 
    // copy string to return parameter
    copyString( outString, displayStrings[ code ] );
@@ -13,6 +13,12 @@
 
 #include "StringUtils.h"
 
+// most simulated CPU cores a config file may ask for
+#define MAX_CPU_CORES 64
+
+// most MLFQ priority levels, each one doubles the quantum of the last
+#define MAX_MLFQ_LEVELS 16
+
 // Note: starts at 3 so it does not compete with StringManipCode values
 typedef enum { CFG_FILE_ACCESS_ERR = 3,
                CFG_CORRUPT_DESCRIPTOR_ERR,
@@ -26,16 +32,56 @@ typedef enum { CFG_FILE_ACCESS_ERR = 3,
                CFG_PROC_CYCLES_CODE,
                CFG_IO_CYCLES_CODE,
                CFG_LOG_TO_CODE,
-               CFG_LOG_FILE_NAME_CODE } ConfigCodeMessages;
+               CFG_LOG_FILE_NAME_CODE,
+               CFG_SIM_CLOCK_CODE,
+               CFG_HARD_DRIVE_CHANNELS_CODE,
+               CFG_KEYBOARD_CHANNELS_CODE,
+               CFG_PRINTER_CHANNELS_CODE,
+               CFG_MONITOR_CHANNELS_CODE,
+               CFG_DISK_SCHED_CODE,
+               CFG_DISK_CYLINDERS_CODE,
+               CFG_DISK_SEEK_TIME_CODE,
+               CFG_INT_COALESCE_COUNT_CODE,
+               CFG_INT_COALESCE_WINDOW_CODE,
+               CFG_CPU_CORES_CODE,
+               CFG_MLFQ_LEVELS_CODE,
+               CFG_MLFQ_BOOST_CODE,
+               CFG_RANDOM_SEED_CODE,
+               CFG_ARRIVAL_RATE_CODE,
+               CFG_SWITCH_COST_CODE,
+               CFG_DECISION_COST_CODE,
+               CFG_WARMUP_COST_CODE,
+               CFG_TRACE_FILE_NAME_CODE,
+               CFG_CHECKPOINT_FILE_NAME_CODE,
+               CFG_CHECKPOINT_INTERVAL_CODE,
+               CFG_RECORD_FILE_NAME_CODE,
+               CFG_METRICS_SOCKET_CODE } ConfigCodeMessages;
 
+// NOTE: CPU_SCHED codes are the first entries of the scheduler registry,
+//       policies added to the registry take the codes after CPU_SCHED_FCFS_N,
+//       so they are kept apart from the other config data codes
 typedef enum { CPU_SCHED_SJF_N_CODE,
                CPU_SCHED_SRTF_P_CODE,
                CPU_SCHED_FCFS_P_CODE,
                CPU_SCHED_RR_P_CODE,
-               CPU_SCHED_FCFS_N_CODE,
-               LOGTO_MONITOR_CODE,
+               CPU_SCHED_FCFS_N_CODE } CpuSchedCodes;
+
+typedef enum { LOGTO_MONITOR_CODE,
                LOGTO_FILE_CODE,
-               LOGTO_BOTH_CODE } ConfigDataCodes;
+               LOGTO_BOTH_CODE,
+               SIM_CLOCK_REAL_CODE,
+               SIM_CLOCK_VIRTUAL_CODE,
+               DISK_SCHED_FCFS_CODE,
+               DISK_SCHED_SSTF_CODE,
+               DISK_SCHED_SCAN_CODE,
+               DISK_SCHED_CLOOK_CODE,
+               LOGTO_NONE_CODE } ConfigDataCodes;
+
+// called with every logged event, by a program embedding the simulator
+// NOTE: EventData is defined in SimRunner.h, its strings last for the call
+struct EventData;
+typedef void ( *EventCallback )( struct EventData* eventData,
+                                                          void* userData );
 
 // config data structure
 typedef struct
@@ -49,17 +95,52 @@ typedef struct
 	int ioCycleRate;
 	int logToCode;
 	char logToFileName[ 100 ];
+
+   // optional settings, defaulted when their line is absent from the file
+   int simClockCode;
+   int hardDriveChannels;
+   int keyboardChannels;
+   int printerChannels;
+   int monitorChannels;
+   int diskSchedCode;
+   int diskCylinders;
+   int diskSeekTimeMs;
+   int intCoalesceCount;
+   int intCoalesceWindowMs;
+   int cpuCores;
+   int mlfqLevels;
+   int mlfqBoostMs;
+   int randomSeed;
+   int arrivalRate;
+   int switchCostCycles;
+   int decisionCostCycles;
+   int warmupCostCycles;
+   char traceFileName[ 100 ];
+   char checkpointFileName[ 100 ];
+   int checkpointIntervalMs;
+   char recordFileName[ 100 ];
+   char metricsSocketName[ 100 ];
+
+   // set by an embedding program, never by a config file
+   EventCallback eventCallback;
+   void* eventUserData;
+   char restoreFileName[ 100 ];
+   char replayFileName[ 100 ];
 } ConfigDataType;
 
 // function prototypes
 int getConfigData( char *fileName, ConfigDataType **configData );
+int readConfigData( FILE *fileAccessPtr, ConfigDataType **configData );
 int getDataLineCode( char *dataBuffer );
-ConfigDataCodes getCpuSchedCode( char *codeStr );
+int getCpuSchedCode( char *codeStr );
 Boolean valueInRange( int lineCode, int intVal, 
                                            double doubleVal, char *stringVal );
 Boolean valueInRange( int lineCode, int intVal, 
                                            double doubleVal, char *stringVal );
 ConfigDataCodes getLogToCode( char *logToStr );
+ConfigDataCodes getSimClockCode( char *clockStr );
+ConfigDataCodes getDiskSchedCode( char *codeStr );
+void setConfigDefaults( ConfigDataType *configData );
 
 void displayConfigData( ConfigDataType *configData );
 void configCodeToString( int code, char *outString );
@@ -0,0 +1,149 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file DeadlineScheduler.c
+ *
+ *
+ * @version 5.44
+ *          Kristopher Moore (19 October 2026)
+ *          Earliest deadline first scheduling policy, EDF-P.
+ */
+
+//needs simRunner for the PCB definition
+#include "SimRunner.h"
+
+//heap key of a process without a deadline, after every real deadline
+#define EDF_NO_DEADLINE 0x7FFFFFFFFFFFFFFFLL
+
+//EDF state, a heap of queued processes keyed by absolute deadline
+typedef struct
+{
+   ProcessHeap heap;
+   int cycleMs;
+
+} DeadlineState;
+
+//policy callbacks, EDF-P
+static void* deadlineInit( int processCount, ConfigDataType* configDataPtr );
+static void deadlineEnqueue( void* state, struct PCB* process );
+static int deadlinePickNext( void* state );
+static int deadlineTimeSlice( void* state, struct PCB* process );
+static void deadlineDestruct( void* state );
+static void deadlineSave( void* state, int processCount, FILE* filePtr );
+static Boolean deadlineRestore( void* state, int processCount,
+                                                            FILE* filePtr );
+
+const SchedulerPolicy edfPPolicy =
+   { "EDF-P", True, deadlineInit, deadlineEnqueue, deadlinePickNext,
+        NULL, NULL, NULL, deadlineTimeSlice, deadlineDestruct,
+                                             deadlineSave, deadlineRestore };
+
+/*
+Function name: deadlineInit
+Algorithm: allocates an empty deadline heap
+Precondition: count of processes in the run
+Postcondition: returns the EDF state
+Exceptions: none
+Notes: none
+*/
+static void* deadlineInit( int processCount, ConfigDataType* configDataPtr )
+{
+   DeadlineState* edf = (DeadlineState*) malloc( sizeof( DeadlineState ) );
+
+   processHeapInit( &edf->heap, processCount );
+   edf->cycleMs = configDataPtr->procCycleRate;
+
+   return edf;
+}
+
+/*
+Function name: deadlineEnqueue
+Algorithm: pushes the process by its absolute deadline, processes without
+            one go after every process with one, in pId order
+Precondition: process not already queued
+Postcondition: process queued
+Exceptions: none
+Notes: O(log n)
+*/
+static void deadlineEnqueue( void* state, struct PCB* process )
+{
+   DeadlineState* edf = (DeadlineState*) state;
+   long long key = process->deadlineUs;
+
+   if( key < 0 )
+   {
+      key = EDF_NO_DEADLINE;
+   }
+
+   processHeapPush( &edf->heap, key, process->pId );
+}
+
+/*
+Function name: deadlinePickNext
+Algorithm: pops the earliest deadline
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int deadlinePickNext( void* state )
+{
+   return processHeapPop( &( (DeadlineState*) state )->heap ).pId;
+}
+
+/*
+Function name: deadlineTimeSlice
+Algorithm: runs one processor cycle at a time, so a process that becomes
+            READY with an earlier deadline preempts at the next cycle
+Precondition: process about to run a P op
+Postcondition: returns the slice in ms
+Exceptions: none
+Notes: ops are also a preemption point, the process is queued again after
+       every op
+*/
+static int deadlineTimeSlice( void* state, struct PCB* process )
+{
+   return ( (DeadlineState*) state )->cycleMs;
+}
+
+/*
+Function name: deadlineDestruct
+Algorithm: frees the deadline heap and the state
+Precondition: state from deadlineInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void deadlineDestruct( void* state )
+{
+   DeadlineState* edf = (DeadlineState*) state;
+
+   processHeapDestruct( &edf->heap );
+   free( edf );
+}
+
+/*
+Function name: deadlineSave
+Algorithm: writes the deadline heap
+Precondition: state from deadlineInit
+Postcondition: state written
+Exceptions: none
+Notes: none
+*/
+static void deadlineSave( void* state, int processCount, FILE* filePtr )
+{
+   processHeapSave( &( (DeadlineState*) state )->heap, filePtr );
+}
+
+/*
+Function name: deadlineRestore
+Algorithm: reads back the deadline heap
+Precondition: state fresh from deadlineInit
+Postcondition: returns True with the heap as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean deadlineRestore( void* state, int processCount,
+                                                             FILE* filePtr )
+{
+   return processHeapRestore( &( (DeadlineState*) state )->heap, filePtr );
+}
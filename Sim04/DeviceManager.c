@@ -0,0 +1,610 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file DeviceManager.c
+ *
+ *
+ * @version 5.10
+ *          Kristopher Moore (19 October 2026)
+ *          Per-device I/O queues and service channels.
+ */
+
+#include <math.h>
+#include "DeviceManager.h"
+#include "simtimer.h"
+
+//device names, in DeviceCode order, as named by the I/O ops
+static const char* const deviceNames[ DEVICE_COUNT ] =
+   { "hard drive", "keyboard", "printer", "monitor" };
+
+/*
+Function name: updateQueueArea
+Algorithm: adds the time the queue spent at its current length to the
+            running area, used for the time weighted average queue length
+Precondition: device lock held
+Postcondition: area and last change time brought up to nowUs
+Exceptions: none
+Notes: none
+*/
+static void updateQueueArea( Device* device, long long nowUs )
+{
+   if( nowUs > device->lastChangeUs )
+   {
+      device->queueAreaUs += device->queueLength
+                                       * ( nowUs - device->lastChangeUs );
+      device->lastChangeUs = nowUs;
+   }
+}
+
+/*
+Function name: startRequest
+Algorithm: grants a channel to a request and records its wait time
+Precondition: device lock held, a free channel
+Postcondition: request granted, channel busy
+Exceptions: none
+Notes: none
+*/
+static void startRequest( Device* device, IORequest* request, long long nowUs )
+{
+   long long waitUs = nowUs - request->submitUs;
+   int distance;
+   long long seekUs;
+
+   //the arm has to travel to the request before the transfer starts, after
+   //any SCAN sweep out to the edge of the disk
+   if( device->hasDiskArm == True )
+   {
+      distance = device->sweepDistance
+                        + abs( request->cylinder - device->headCylinder );
+      device->sweepDistance = 0;
+      seekUs = diskSeekUs( device, distance );
+
+      if( request->cylinder != device->headCylinder )
+      {
+         device->scanDirection =
+                     request->cylinder > device->headCylinder ? 1 : -1;
+      }
+
+      device->headCylinder = request->cylinder;
+      device->seekCount++;
+      device->totalSeekDistance += distance;
+      device->totalSeekUs += seekUs;
+      request->serviceUs += seekUs;
+   }
+
+   request->granted = True;
+   request->startUs = nowUs;
+   device->busyChannels++;
+   device->busyUs += request->serviceUs;
+   device->totalWaitUs += waitUs;
+
+   if( waitUs > device->maxWaitUs )
+   {
+      device->maxWaitUs = waitUs;
+   }
+}
+
+/*
+Function name: removeNextRequest
+Algorithm: unlinks the next request to service from the device queue. The
+            hard drive orders its queue by the disk scheduling code,
+            FCFS:   the oldest request
+            SSTF:   the request closest to the head
+            SCAN:   the closest request in the direction of travel, when
+                    there are none left that way the arm carries on to the
+                    edge of the disk, and turns around there
+            C-LOOK: the closest request at or above the head, wrapping to
+                    the lowest cylinder when there are none left above
+            every other device is FIFO
+Precondition: device lock held, queue not empty
+Postcondition: returns the request, removed from the queue
+Exceptions: none
+Notes: O(n) in the queue length, ties go to the oldest request
+*/
+static IORequest* removeNextRequest( Device* device )
+{
+   IORequest* request = device->queueHead;
+   IORequest* previous = NULL;
+   IORequest* bestRequest = device->queueHead;
+   IORequest* bestPrevious = NULL;
+   IORequest* lowRequest = NULL;
+   IORequest* lowPrevious = NULL;
+   int head = device->headCylinder;
+   int bestDistance = -1;
+   int distance;
+   int edge;
+   int schedCode = device->hasDiskArm ? device->diskSchedCode
+                                      : DISK_SCHED_FCFS_CODE;
+
+   if( schedCode == DISK_SCHED_SSTF_CODE )
+   {
+      while( request != NULL )
+      {
+         distance = abs( request->cylinder - head );
+         if( bestDistance < 0 || distance < bestDistance )
+         {
+            bestDistance = distance;
+            bestRequest = request;
+            bestPrevious = previous;
+         }
+
+         previous = request;
+         request = request->next;
+      }
+   }
+
+   else if( schedCode == DISK_SCHED_SCAN_CODE
+                                       || schedCode == DISK_SCHED_CLOOK_CODE )
+   {
+      //SCAN may sweep down, C-LOOK only ever services going up
+      if( schedCode == DISK_SCHED_CLOOK_CODE )
+      {
+         device->scanDirection = 1;
+      }
+
+      while( request != NULL )
+      {
+         distance = ( request->cylinder - head ) * device->scanDirection;
+         if( distance >= 0 && ( bestDistance < 0 || distance < bestDistance ) )
+         {
+            bestDistance = distance;
+            bestRequest = request;
+            bestPrevious = previous;
+         }
+
+         //track the lowest cylinder, for the C-LOOK wrap around
+         if( lowRequest == NULL || request->cylinder < lowRequest->cylinder )
+         {
+            lowRequest = request;
+            lowPrevious = previous;
+         }
+
+         previous = request;
+         request = request->next;
+      }
+
+      //nothing left in the direction of travel
+      if( bestDistance < 0 )
+      {
+         if( schedCode == DISK_SCHED_CLOOK_CODE )
+         {
+            bestRequest = lowRequest;
+            bestPrevious = lowPrevious;
+         }
+         else
+         {
+            //the sweep to the edge is charged with the next seek
+            edge = device->scanDirection > 0 ? device->cylinders - 1 : 0;
+            device->sweepDistance += abs( edge - head );
+            device->headCylinder = edge;
+            device->scanDirection = -device->scanDirection;
+            return removeNextRequest( device );
+         }
+      }
+   }
+
+   //unlink the chosen request
+   if( bestPrevious == NULL )
+   {
+      device->queueHead = bestRequest->next;
+   }
+   else
+   {
+      bestPrevious->next = bestRequest->next;
+   }
+
+   if( device->queueTail == bestRequest )
+   {
+      device->queueTail = bestPrevious;
+   }
+
+   bestRequest->next = NULL;
+   device->queueLength--;
+
+   return bestRequest;
+}
+
+/*
+Function name: hasFreeChannel
+Algorithm: checks the busy channels against the configured channel count
+Precondition: device lock held
+Postcondition: returns True if another request may start
+Exceptions: none
+Notes: zero channels means the device is unlimited
+*/
+static Boolean hasFreeChannel( Device* device )
+{
+   return device->channels == 0 || device->busyChannels < device->channels;
+}
+
+/*
+Function name: deviceTableInit
+Algorithm: names each device, sets its channel count from the config data
+            and clears its queue and statistics
+Precondition: config data loaded
+Postcondition: every device idle with an empty queue
+Exceptions: none
+Notes: startUs is the clock value the utilisation is measured from
+*/
+void deviceTableInit( DeviceTable* deviceTable, ConfigDataType* configDataPtr,
+                                                           long long startUs )
+{
+   int deviceChannels[ DEVICE_COUNT ];
+   Device* device;
+   int index;
+
+   deviceChannels[ DEV_HARD_DRIVE ] = configDataPtr->hardDriveChannels;
+   deviceChannels[ DEV_KEYBOARD ] = configDataPtr->keyboardChannels;
+   deviceChannels[ DEV_PRINTER ] = configDataPtr->printerChannels;
+   deviceChannels[ DEV_MONITOR ] = configDataPtr->monitorChannels;
+
+   deviceTable->startUs = startUs;
+
+   for( index = 0; index < DEVICE_COUNT; index++ )
+   {
+      device = &deviceTable->devices[ index ];
+
+      copyString( device->name, (char*) deviceNames[ index ] );
+      device->channels = deviceChannels[ index ];
+      device->busyChannels = 0;
+      device->queueHead = NULL;
+      device->queueTail = NULL;
+      device->queueLength = 0;
+
+      device->requestCount = 0;
+      device->queuedCount = 0;
+      device->totalWaitUs = 0;
+      device->maxWaitUs = 0;
+      device->busyUs = 0;
+      device->queueAreaUs = 0;
+      device->lastChangeUs = startUs;
+      device->maxQueueLength = 0;
+
+      //only the hard drive has an arm to move
+      device->hasDiskArm = index == DEV_HARD_DRIVE ? True : False;
+      device->diskSchedCode = configDataPtr->diskSchedCode;
+      device->cylinders = configDataPtr->diskCylinders;
+      device->fullSeekMs = configDataPtr->diskSeekTimeMs;
+      device->headCylinder = 0;
+      device->scanDirection = 1;
+      device->sweepDistance = 0;
+      device->seekCount = 0;
+      device->totalSeekDistance = 0;
+      device->totalSeekUs = 0;
+
+      device->completedCount = 0;
+      device->responseCapacity = 64;
+      device->responseUs = (long long*) malloc( sizeof( long long )
+                                                * device->responseCapacity );
+      histogramInit( &device->serviceHist );
+
+      pthread_mutex_init( &device->lock, NULL );
+      pthread_cond_init( &device->grantCond, NULL );
+   }
+}
+
+/*
+Function name: deviceTableDestruct
+Algorithm: frees any requests still queued and releases the locks
+Precondition: no thread is still using the devices
+Postcondition: device table must be re-initialized before use
+Exceptions: none
+Notes: none
+*/
+void deviceTableDestruct( DeviceTable* deviceTable )
+{
+   IORequest* nextRequest;
+   Device* device;
+   int index;
+
+   for( index = 0; index < DEVICE_COUNT; index++ )
+   {
+      device = &deviceTable->devices[ index ];
+
+      while( device->queueHead != NULL )
+      {
+         nextRequest = device->queueHead->next;
+         free( device->queueHead );
+         device->queueHead = nextRequest;
+      }
+
+      device->queueTail = NULL;
+      device->queueLength = 0;
+
+      free( device->responseUs );
+      device->responseUs = NULL;
+
+      pthread_mutex_destroy( &device->lock );
+      pthread_cond_destroy( &device->grantCond );
+   }
+}
+
+/*
+Function name: getDeviceCode
+Algorithm: matches an I/O op name against the device names
+Precondition: opName from a valid I or O op
+Postcondition: returns the matching device code
+Exceptions: defaults to the monitor
+Notes: none
+*/
+DeviceCode getDeviceCode( char* opName )
+{
+   if( compareString( opName, "hard drive" ) == STR_EQ )
+   {
+      return DEV_HARD_DRIVE;
+   }
+
+   if( compareString( opName, "keyboard" ) == STR_EQ )
+   {
+      return DEV_KEYBOARD;
+   }
+
+   if( compareString( opName, "printer" ) == STR_EQ )
+   {
+      return DEV_PRINTER;
+   }
+
+   return DEV_MONITOR;
+}
+
+/*
+Function name: getDeviceName
+Algorithm: looks up the name of a device code
+Precondition: deviceCode is a valid device
+Postcondition: returns the name, as used by the I/O ops
+Exceptions: none
+Notes: none
+*/
+const char* getDeviceName( DeviceCode deviceCode )
+{
+   return deviceNames[ deviceCode ];
+}
+
+/*
+Function name: createIORequest
+Algorithm: allocates and fills a request for one I/O op
+Precondition: service time already converted from cycles, seek time is
+               added when the request starts
+Postcondition: returns the new, ungranted request
+Exceptions: none
+Notes: the caller frees the request once its I/O is complete
+*/
+IORequest* createIORequest( int pId, DeviceCode deviceCode, int cylinder,
+                                     long long submitUs, long long serviceUs )
+{
+   IORequest* request = (IORequest*) malloc( sizeof( IORequest ) );
+
+   request->pId = pId;
+   request->deviceCode = deviceCode;
+   request->cylinder = cylinder;
+   request->submitUs = submitUs;
+   request->startUs = -1;
+   request->serviceUs = serviceUs;
+   request->granted = False;
+   request->next = NULL;
+
+   return request;
+}
+
+/*
+Function name: deviceSubmit
+Algorithm: starts the request at once if a channel is free and nobody is
+            waiting ahead of it, otherwise appends it to the device queue
+Precondition: request submit time set
+Postcondition: returns True if the request started, False if it is queued
+Exceptions: none
+Notes: a started request completes serviceUs after nowUs
+*/
+Boolean deviceSubmit( Device* device, IORequest* request, long long nowUs )
+{
+   Boolean started = False;
+
+   pthread_mutex_lock( &device->lock );
+
+   device->requestCount++;
+   updateQueueArea( device, nowUs );
+
+   if( device->queueLength == 0 && hasFreeChannel( device ) )
+   {
+      startRequest( device, request, nowUs );
+      started = True;
+   }
+   else
+   {
+      //FIFO, join at the back of the queue
+      request->next = NULL;
+      if( device->queueTail == NULL )
+      {
+         device->queueHead = request;
+      }
+      else
+      {
+         device->queueTail->next = request;
+      }
+      device->queueTail = request;
+
+      device->queueLength++;
+      device->queuedCount++;
+      if( device->queueLength > device->maxQueueLength )
+      {
+         device->maxQueueLength = device->queueLength;
+      }
+   }
+
+   pthread_mutex_unlock( &device->lock );
+
+   return started;
+}
+
+/*
+Function name: deviceComplete
+Algorithm: releases the channel held by a finished request, and starts the
+            request at the front of the queue on it if one is waiting
+Precondition: request was granted on this device
+Postcondition: returns the request just started, or NULL if none waiting
+Exceptions: none
+Notes: the finished request is not freed here
+*/
+IORequest* deviceComplete( Device* device, IORequest* request,
+                                                             long long nowUs )
+{
+   IORequest* nextRequest = NULL;
+
+   pthread_mutex_lock( &device->lock );
+
+   device->busyChannels--;
+
+   //keep the response time of every finished request
+   if( device->completedCount == device->responseCapacity )
+   {
+      device->responseCapacity *= 2;
+      device->responseUs = (long long*) realloc( device->responseUs,
+                           sizeof( long long ) * device->responseCapacity );
+   }
+   device->responseUs[ device->completedCount ] = nowUs - request->submitUs;
+   device->completedCount++;
+   histogramRecord( &device->serviceHist, nowUs - request->startUs );
+
+   if( device->queueLength > 0 && hasFreeChannel( device ) )
+   {
+      updateQueueArea( device, nowUs );
+
+      nextRequest = removeNextRequest( device );
+      startRequest( device, nextRequest, nowUs );
+   }
+
+   pthread_mutex_unlock( &device->lock );
+
+   return nextRequest;
+}
+
+/*
+Function name: deviceAcquire
+Algorithm: real time version of deviceSubmit, blocks the calling I/O thread
+            until its request has been granted a channel
+Precondition: called from an I/O thread
+Postcondition: request holds a channel
+Exceptions: none
+Notes: wall clock micro-seconds are used for the statistics
+*/
+void deviceAcquire( Device* device, IORequest* request )
+{
+   request->submitUs = wallTimeUs();
+
+   if( deviceSubmit( device, request, request->submitUs ) == False )
+   {
+      pthread_mutex_lock( &device->lock );
+
+      while( request->granted == False )
+      {
+         pthread_cond_wait( &device->grantCond, &device->lock );
+      }
+
+      pthread_mutex_unlock( &device->lock );
+   }
+}
+
+/*
+Function name: deviceRelease
+Algorithm: real time version of deviceComplete, wakes the waiting threads
+            if a queued request was granted the freed channel
+Precondition: request holds a channel on this device
+Postcondition: channel released
+Exceptions: none
+Notes: none
+*/
+void deviceRelease( Device* device, IORequest* request )
+{
+   if( deviceComplete( device, request, wallTimeUs() ) != NULL )
+   {
+      pthread_mutex_lock( &device->lock );
+      pthread_cond_broadcast( &device->grantCond );
+      pthread_mutex_unlock( &device->lock );
+   }
+}
+
+/*
+Function name: getDiskCylinder
+Algorithm: hashes the process and the count of its I/O ops so far into a
+            cylinder, spreading requests over the disk
+Precondition: cylinders greater than zero
+Postcondition: returns a cylinder from 0 to cylinders - 1
+Exceptions: none
+Notes: the metadata has no cylinder, this keeps it the same on every run
+*/
+int getDiskCylinder( int pId, int ioCount, int cylinders )
+{
+   unsigned int hashValue = (unsigned int) pId * 2654435761u
+                                    ^ (unsigned int) ( ioCount + 1 ) * 40503u;
+
+   hashValue ^= hashValue >> 15;
+   hashValue *= 2246822519u;
+   hashValue ^= hashValue >> 13;
+
+   return (int) ( hashValue % (unsigned int) cylinders );
+}
+
+/*
+Function name: diskSeekUs
+Algorithm: seek time grows with the square root of the distance travelled,
+            reaching the full stroke seek time across every cylinder
+Precondition: distance in cylinders
+Postcondition: returns the seek time in micro-seconds
+Exceptions: none
+Notes: zero distance, or zero full stroke time, costs nothing
+*/
+long long diskSeekUs( Device* device, int distance )
+{
+   if( distance == 0 || device->fullSeekMs == 0 || device->cylinders < 2 )
+   {
+      return 0;
+   }
+
+   return (long long) ( device->fullSeekMs * 1000.0
+                        * sqrt( (double) distance / ( device->cylinders - 1 ) ) );
+}
+
+/*
+Function name: compareLongLong
+Algorithm: qsort comparison for response times
+Precondition: two pointers to long long values
+Postcondition: returns less than, equal to or greater than zero
+Exceptions: none
+Notes: none
+*/
+static int compareLongLong( const void* oneValue, const void* otherValue )
+{
+   long long oneTime = *(const long long*) oneValue;
+   long long otherTime = *(const long long*) otherValue;
+
+   return ( oneTime > otherTime ) - ( oneTime < otherTime );
+}
+
+/*
+Function name: deviceResponsePercentile
+Algorithm: sorts the recorded response times and returns the nearest rank
+            percentile
+Precondition: run finished, percentile from 0 to 100
+Postcondition: returns the percentile response time in micro-seconds
+Exceptions: returns 0 if no request has completed
+Notes: sorts in place, later calls are cheap
+*/
+long long deviceResponsePercentile( Device* device, double percentile )
+{
+   long long rank;
+
+   if( device->completedCount == 0 )
+   {
+      return 0;
+   }
+
+   qsort( device->responseUs, device->completedCount, sizeof( long long ),
+                                                            compareLongLong );
+
+   rank = (long long) ceil( percentile / 100.0 * device->completedCount ) - 1;
+   if( rank < 0 )
+   {
+      rank = 0;
+   }
+
+   return device->responseUs[ rank ];
+}
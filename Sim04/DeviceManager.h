@@ -0,0 +1,112 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file DeviceManager.h
+ *
+ * @version 5.10
+ *          Kristopher Moore (19 October 2026)
+ *          Per-device I/O queues and service channels.
+ */
+
+#ifndef DEVICE_MANAGER_H
+#define DEVICE_MANAGER_H
+
+#include <pthread.h>
+#include "ConfigAccess.h"
+#include "Histogram.h"
+
+//I/O devices, one for each I/O op name accepted in the metadata
+typedef enum
+{
+   DEV_HARD_DRIVE,
+   DEV_KEYBOARD,
+   DEV_PRINTER,
+   DEV_MONITOR,
+   DEVICE_COUNT
+
+} DeviceCode;
+
+//one I/O op waiting for, or holding, a device channel
+typedef struct IORequest
+{
+   int pId;
+   DeviceCode deviceCode;
+   int cylinder;
+   long long submitUs;
+   long long startUs;
+   long long serviceUs;
+   Boolean granted;
+
+   struct IORequest *next;
+} IORequest;
+
+//device with a FIFO queue in front of its service channels
+typedef struct
+{
+   char name[ 20 ];
+   int channels;
+   int busyChannels;
+   IORequest* queueHead;
+   IORequest* queueTail;
+   int queueLength;
+
+   //statistics, all times in micro-seconds of simulated time
+   long long requestCount;
+   long long queuedCount;
+   long long totalWaitUs;
+   long long maxWaitUs;
+   long long busyUs;
+   long long queueAreaUs;
+   long long lastChangeUs;
+   int maxQueueLength;
+
+   //disk arm model, only used by the hard drive
+   Boolean hasDiskArm;
+   int diskSchedCode;
+   int cylinders;
+   int fullSeekMs;
+   int headCylinder;
+   int scanDirection;
+   int sweepDistance;
+   long long seekCount;
+   long long totalSeekDistance;
+   long long totalSeekUs;
+
+   //request response times, submit to completion, for tail latencies
+   long long* responseUs;
+   long long completedCount;
+   long long responseCapacity;
+
+   //service times, channel grant to completion
+   LatencyHistogram serviceHist;
+
+   //guards the above when I/O runs on real threads
+   pthread_mutex_t lock;
+   pthread_cond_t grantCond;
+} Device;
+
+//all devices of one simulation
+typedef struct
+{
+   Device devices[ DEVICE_COUNT ];
+   long long startUs;
+
+} DeviceTable;
+
+//function prototypes
+void deviceTableInit( DeviceTable* deviceTable, ConfigDataType* configDataPtr,
+                                                          long long startUs );
+void deviceTableDestruct( DeviceTable* deviceTable );
+DeviceCode getDeviceCode( char* opName );
+const char* getDeviceName( DeviceCode deviceCode );
+IORequest* createIORequest( int pId, DeviceCode deviceCode, int cylinder,
+                                    long long submitUs, long long serviceUs );
+int getDiskCylinder( int pId, int ioCount, int cylinders );
+long long diskSeekUs( Device* device, int distance );
+long long deviceResponsePercentile( Device* device, double percentile );
+Boolean deviceSubmit( Device* device, IORequest* request, long long nowUs );
+IORequest* deviceComplete( Device* device, IORequest* request,
+                                                            long long nowUs );
+void deviceAcquire( Device* device, IORequest* request );
+void deviceRelease( Device* device, IORequest* request );
+
+#endif // DEVICE_MANAGER_H
@@ -0,0 +1,206 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file EventQueue.c
+ *
+ *
+ * @version 5.00
+ *          Kristopher Moore (19 October 2026)
+ *          Event calendar for the virtual clock simulator.
+ */
+
+#include "EventQueue.h"
+
+/*
+Function name: eventComesFirst
+Algorithm: compares two events by simulated time, ties broken by the order
+            in which they were pushed
+Precondition: two valid events
+Postcondition: returns True if oneEvent must be dispatched before otherEvent
+Exceptions: none
+Notes: the sequence tie break keeps dispatch order deterministic
+*/
+static Boolean eventComesFirst( SimEvent* oneEvent, SimEvent* otherEvent )
+{
+   if( oneEvent->timeUs != otherEvent->timeUs )
+   {
+      return oneEvent->timeUs < otherEvent->timeUs;
+   }
+
+   return oneEvent->sequence < otherEvent->sequence;
+}
+
+/*
+Function name: eventQueueInit
+Algorithm: allocates the heap array and resets the counters
+Precondition: pointer to an EventQueue, capacity greater than zero
+Postcondition: queue is empty and ready for pushes
+Exceptions: none
+Notes: capacity is only a starting size, the heap grows as needed
+*/
+void eventQueueInit( EventQueue* eventQueue, int capacity )
+{
+   if( capacity < 1 )
+   {
+      capacity = 1;
+   }
+
+   eventQueue->heap = (SimEvent*) malloc( sizeof( SimEvent ) * capacity );
+   eventQueue->size = 0;
+   eventQueue->capacity = capacity;
+   eventQueue->nextSequence = 0;
+}
+
+/*
+Function name: eventQueuePush
+Algorithm: places the new event at the bottom of the heap and sifts it up
+            until its parent comes first, doubling the array when full
+Precondition: initialized queue
+Postcondition: event is stored on the calendar
+Exceptions: none
+Notes: O(log n)
+*/
+void eventQueuePush( EventQueue* eventQueue, long long timeUs,
+                                          SimEventType eventType, int pId )
+{
+   SimEvent newEvent;
+   int childIndex, parentIndex;
+
+   //grow the heap if we have run out of room
+   if( eventQueue->size == eventQueue->capacity )
+   {
+      eventQueue->capacity *= 2;
+      eventQueue->heap = (SimEvent*) realloc( eventQueue->heap,
+                              sizeof( SimEvent ) * eventQueue->capacity );
+   }
+
+   newEvent.timeUs = timeUs;
+   newEvent.sequence = eventQueue->nextSequence;
+   newEvent.eventType = eventType;
+   newEvent.pId = pId;
+   eventQueue->nextSequence++;
+
+   //sift up, moving parents down until our slot is found
+   childIndex = eventQueue->size;
+   while( childIndex > 0 )
+   {
+      parentIndex = ( childIndex - 1 ) / 2;
+
+      if( !eventComesFirst( &newEvent, &eventQueue->heap[ parentIndex ] ) )
+      {
+         break;
+      }
+
+      eventQueue->heap[ childIndex ] = eventQueue->heap[ parentIndex ];
+      childIndex = parentIndex;
+   }
+
+   eventQueue->heap[ childIndex ] = newEvent;
+   eventQueue->size++;
+}
+
+/*
+Function name: eventQueuePop
+Algorithm: removes the earliest event, moves the last event to the root and
+            sifts it down below any child that comes first
+Precondition: initialized, non-empty queue
+Postcondition: returns the earliest event, removed from the calendar
+Exceptions: returns an event with pId -1 if the queue is empty
+Notes: O(log n)
+*/
+SimEvent eventQueuePop( EventQueue* eventQueue )
+{
+   SimEvent firstEvent, lastEvent;
+   int parentIndex = 0;
+   int childIndex;
+
+   if( eventQueue->size == 0 )
+   {
+      firstEvent.timeUs = 0;
+      firstEvent.sequence = -1;
+      firstEvent.eventType = EV_PROCESS_ARRIVAL;
+      firstEvent.pId = -1;
+      return firstEvent;
+   }
+
+   firstEvent = eventQueue->heap[ 0 ];
+   eventQueue->size--;
+   lastEvent = eventQueue->heap[ eventQueue->size ];
+
+   //sift down, moving the earlier child up until our slot is found
+   childIndex = 1;
+   while( childIndex < eventQueue->size )
+   {
+      if( childIndex + 1 < eventQueue->size
+            && eventComesFirst( &eventQueue->heap[ childIndex + 1 ],
+                                          &eventQueue->heap[ childIndex ] ) )
+      {
+         childIndex++;
+      }
+
+      if( !eventComesFirst( &eventQueue->heap[ childIndex ], &lastEvent ) )
+      {
+         break;
+      }
+
+      eventQueue->heap[ parentIndex ] = eventQueue->heap[ childIndex ];
+      parentIndex = childIndex;
+      childIndex = parentIndex * 2 + 1;
+   }
+
+   eventQueue->heap[ parentIndex ] = lastEvent;
+
+   return firstEvent;
+}
+
+/*
+Function name: eventQueuePeek
+Algorithm: returns the earliest event without removing it
+Precondition: initialized, non-empty queue
+Postcondition: calendar is unchanged
+Exceptions: returns an event with pId -1 if the queue is empty
+Notes: none
+*/
+SimEvent eventQueuePeek( EventQueue* eventQueue )
+{
+   SimEvent emptyEvent;
+
+   if( eventQueue->size == 0 )
+   {
+      emptyEvent.timeUs = 0;
+      emptyEvent.sequence = -1;
+      emptyEvent.eventType = EV_PROCESS_ARRIVAL;
+      emptyEvent.pId = -1;
+      return emptyEvent;
+   }
+
+   return eventQueue->heap[ 0 ];
+}
+
+/*
+Function name: eventQueueIsEmpty
+Algorithm: reports whether any events remain on the calendar
+Precondition: initialized queue
+Postcondition: returns True for size 0 and False otherwise
+Exceptions: none
+Notes: none
+*/
+Boolean eventQueueIsEmpty( EventQueue* eventQueue )
+{
+   return eventQueue->size == 0;
+}
+
+/*
+Function name: eventQueueDestruct
+Algorithm: frees the heap array
+Precondition: initialized queue
+Postcondition: memory released, queue must be re-initialized before use
+Exceptions: none
+Notes: none
+*/
+void eventQueueDestruct( EventQueue* eventQueue )
+{
+   free( eventQueue->heap );
+   eventQueue->heap = NULL;
+   eventQueue->size = 0;
+   eventQueue->capacity = 0;
+}
@@ -0,0 +1,56 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file EventQueue.h
+ *
+ * @version 5.00
+ *          Kristopher Moore (19 October 2026)
+ *          Event calendar for the virtual clock simulator.
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "StringUtils.h"
+
+//Simulator event types, kept on the calendar until their time arrives
+typedef enum
+{
+   EV_PROCESS_ARRIVAL,
+   EV_OP_COMPLETE,
+   EV_IO_INTERRUPT,
+   EV_QUANTUM_EXPIRY,
+   EV_INTERRUPT_FLUSH,
+   EV_DISPATCH_DONE
+
+} SimEventType;
+
+//single calendar entry, ordered by time then by insertion sequence
+typedef struct
+{
+   long long timeUs;
+   long long sequence;
+   SimEventType eventType;
+   int pId;
+
+} SimEvent;
+
+//binary min-heap of events keyed by simulated time
+typedef struct
+{
+   SimEvent* heap;
+   int size;
+   int capacity;
+   long long nextSequence;
+
+} EventQueue;
+
+//function prototypes
+void eventQueueInit( EventQueue* eventQueue, int capacity );
+void eventQueuePush( EventQueue* eventQueue, long long timeUs,
+                                          SimEventType eventType, int pId );
+SimEvent eventQueuePop( EventQueue* eventQueue );
+SimEvent eventQueuePeek( EventQueue* eventQueue );
+Boolean eventQueueIsEmpty( EventQueue* eventQueue );
+void eventQueueDestruct( EventQueue* eventQueue );
+
+#endif // EVENT_QUEUE_H
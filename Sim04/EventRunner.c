@@ -0,0 +1,1016 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file EventRunner.c
+ *
+ *
+ * @version 5.00
+ *          Kristopher Moore (19 October 2026)
+ *          Discrete-event simulator on a virtual clock.
+ */
+
+//needs simRunner for prototypes and data definititons
+#include "SimRunner.h"
+
+/*
+Function name: eventSimulationRunner
+Algorithm: builds the PCBs the same way simulationRunner does, then drives
+            the simulation from an event calendar instead of real timers.
+            Whenever the CPU is free the scheduler picks a READY process and
+            its next op is started, otherwise the earliest event is popped,
+            the virtual clock jumps to its time, and the event is dispatched.
+Precondition: correctly configured config.cnf and metadata.mdf files
+Postcondition: simulates in accordance with specifications of config file,
+               in virtual time, with identical output on every run, and
+               fills runSummaryPtr when it is not NULL
+Exceptions: none
+Notes: I/O ops never spawn threads here, their completion is an event.
+       The run keeps all of its state in sim and only reads mdData, so
+       runs on different configs may share one meta data list. When the
+       config names a restore file the run carries on from that checkpoint
+       instead of starting at time zero. When it names a replay file, each
+       I/O completes and each interrupt is serviced when the recording says
+*/
+int eventSimulationRunner( ConfigDataType* configDataPtr, OpCodeType* mdData,
+                                                   RunSummary* runSummaryPtr )
+{
+   //initializations///////////////////////////////////////////////////////////
+   EventSimulation sim;
+   RunSummary runSummary;
+   LogLinkedList* newNodePtr;
+   MMU* mmuNewPtr;
+   char checkIfFile[STD_STR_LEN];
+   OpCodeType* loopMetaDataPtr = mdData;
+   SimEvent simEvent;
+   int indexI = 0;
+   Boolean dispatched = False;
+   Boolean coreFree = False;
+   Boolean restoring = configDataPtr->restoreFileName[ 0 ] != NULL_CHAR
+                                                            ? True : False;
+   PROFILE_BEGIN( PROF_RUN );
+
+   sim.configDataPtr = configDataPtr;
+   sim.clockUs = 0;
+   sim.eventCount = 0;
+   sim.exitCount = 0;
+   sim.coreCount = configDataPtr->cpuCores;
+   sim.pendingCount = 0;
+   sim.pendingSinceUs = 0;
+   sim.recorder.filePtr = NULL;
+   sim.replay = NULL;
+   sim.interruptStats.serviced = 0;
+   sim.interruptStats.batches = 0;
+   sim.interruptStats.maxBatch = 0;
+   sim.deadlineStats.deadlines = 0;
+   sim.deadlineStats.missed = 0;
+   sim.deadlineStats.totalLatenessUs = 0;
+   sim.deadlineStats.maxLatenessUs = 0;
+   histogramInit( &sim.latencyStats.opRunUs );
+   histogramInit( &sim.latencyStats.interruptUs );
+   histogramInit( &sim.latencyStats.decisionNs );
+
+   //IMPORTANT: initialization steps for our Logging linked list,
+   newNodePtr = createLogNode( " " );
+   sim.listHeadPtr = addNodeLL( NULL, newNodePtr );
+   free( newNodePtr );
+
+   //IMPORTANT: initilization steps for our MMU (linked list) to be safe
+   mmuNewPtr = ( MMU * ) malloc( sizeof( MMU ) );
+   *mmuNewPtr = fillMMU( -1, -1, -1, -1 );
+   sim.mmuHeadPtr = addNodeMMU( NULL, mmuNewPtr );
+   free( mmuNewPtr );
+
+
+   //Start Event Logging////////////////////////////////////////////////////////
+   if( configDataPtr->logToCode != LOGTO_NONE_CODE )
+   {
+      printf( "==========================\n" );
+      if( restoring == True )
+      {
+         printf( "Resume Simulation from %s\n\n",
+                                             configDataPtr->restoreFileName );
+      }
+      else
+      {
+         printf( "Begin Simulation\n\n" );
+      }
+   }
+
+   //the trace and the metrics socket, if asked for, follow every event
+   //from here on
+   traceOpen( configDataPtr );
+   metricsOpen( configDataPtr, False );
+
+   //EVENT LOG: System Start, Create PCB'S, a restored run logged them already
+   if( restoring == False )
+   {
+      logSimEvent( &sim, OS, SystemStart, -1 );
+      logSimEvent( &sim, OS, CreatePCBs, -1 );
+   }
+
+   //find processCount, then create our PCBs on the heap, so large
+   //workloads are not limited by the stack
+   sim.processCount = findProcessCount( loopMetaDataPtr, mdData );
+   sim.pcbArray = (PCB*) malloc( sizeof( PCB ) * ( sim.processCount + 1 ) );
+   createPCBs( sim.pcbArray, loopMetaDataPtr, sim.processCount );
+   assignCores( sim.pcbArray, sim.processCount, sim.coreCount );
+   sim.pendingInterrupts = (int*) malloc( sizeof( int ) 
+                                                * ( sim.processCount + 1 ) );
+   sim.pendingRaisedUs = (long long*) malloc( sizeof( long long ) 
+                                                * ( sim.processCount + 1 ) );
+   calcRemainingTimes( sim.pcbArray, configDataPtr, sim.processCount );
+   sim.staggeredArrivals = assignArrivals( sim.pcbArray, sim.processCount,
+                                                            configDataPtr );
+
+   //EVENT LOG: All Processes init in NEW
+   if( restoring == False )
+   {
+      logSimEvent( &sim, OS, AllProcNEW, -1 );
+   }
+
+   //CPU cores, and I/O devices, idle with empty queues at time zero
+   sim.cores = (SimCore*) malloc( sizeof( SimCore ) * sim.coreCount );
+   sim.schedulers = (Scheduler*) malloc( sizeof( Scheduler ) * sim.coreCount );
+   for( indexI = 0; indexI < sim.coreCount; indexI++ )
+   {
+      schedulerInit( &sim.schedulers[indexI], configDataPtr, sim.processCount );
+      sim.cores[indexI].runningProcess = -1;
+      sim.cores[indexI].lastDispatched = -1;
+      sim.cores[indexI].busySinceUs = 0;
+      sim.cores[indexI].coreStats.busyUs = 0;
+      sim.cores[indexI].coreStats.dispatches = 0;
+      sim.cores[indexI].coreStats.steals = 0;
+      sim.cores[indexI].coreStats.readyWaitUs = 0;
+      sim.cores[indexI].coreStats.maxReadyWaitUs = 0;
+      sim.cores[indexI].coreStats.contextSwitches = 0;
+      sim.cores[indexI].coreStats.switchOverheadUs = 0;
+      sim.cores[indexI].coreStats.warmupUs = 0;
+   }
+   deviceTableInit( &sim.deviceTable, configDataPtr, 0 );
+
+   //IMPORTANT: initialization of the event calendar, every process arrives
+   eventQueueInit( &sim.eventQueue, sim.processCount * 2 + 16 );
+
+   //a replay reads its whole recording before the first event, a recording
+   //covers a run from time zero, so a restored run is not recorded, nor is
+   //a replay, which would write over the recording it is reading when the
+   //config names the same file
+   if( configDataPtr->replayFileName[ 0 ] != NULL_CHAR )
+   {
+      sim.replay = replayLoad( configDataPtr->replayFileName,
+                                                         sim.processCount );
+      if( sim.replay == NULL )
+      {
+         traceClose( configDataPtr );
+         metricsClose( configDataPtr );
+         destructSimulation( &sim );
+         return 1;
+      }
+   }
+   if( restoring == False && sim.replay == NULL )
+   {
+      recordOpen( &sim.recorder, configDataPtr, sim.processCount, 0, False );
+   }
+
+   //a restored run takes everything built above back to the checkpoint
+   if( restoring == True )
+   {
+      if( restoreCheckpoint( &sim, mdData ) == False )
+      {
+         traceClose( configDataPtr );
+         metricsClose( configDataPtr );
+         destructSimulation( &sim );
+         return 1;
+      }
+   }
+   else
+   {
+      for( indexI = 0; indexI < sim.processCount; indexI++ )
+      {
+         eventQueuePush( &sim.eventQueue, sim.pcbArray[indexI].arrivalUs,
+                                                EV_PROCESS_ARRIVAL, indexI );
+      }
+
+      //EVENT LOG: All Processes init in READY, unless they arrive over time
+      if( sim.staggeredArrivals == False )
+      {
+         logSimEvent( &sim, OS, AllProcREADY, -1 );
+      }
+   }
+
+   //the metrics socket counts from the state the run starts in, which a
+   //restored run brought back with it
+   seedMetrics( &sim );
+
+   //a checkpoint does not hold a replay's place in its recording
+   if( sim.replay == NULL )
+   {
+      checkpointArm( &sim );
+   }
+   else
+   {
+      sim.nextCheckpointUs = -1;
+   }
+
+
+   //MAIN EVENT LOOP -- Loop for P not in EXIT /////////////////////////////////
+   while( sim.exitCount < sim.processCount )
+   {
+      //between passes the state is whole, so it may be checkpointed
+      if( checkpointDue( &sim ) == True )
+      {
+         writeCheckpoint( &sim, mdData );
+      }
+
+      //every free core lets the scheduler pick from what is READY right now
+      dispatched = False;
+      coreFree = False;
+      for( indexI = 0; indexI < sim.coreCount; indexI++ )
+      {
+         if( sim.cores[indexI].runningProcess == -1 )
+         {
+            if( dispatchProcess( &sim, indexI ) == True )
+            {
+               dispatched = True;
+            }
+            else
+            {
+               coreFree = True;
+            }
+         }
+      }
+
+      if( dispatched == True )
+      {
+         continue;
+      }
+
+      //nothing is READY, so a held back batch of interrupts may be due,
+      //for a replay the next batch of its recording
+      if( coreFree == True && sim.replay != NULL )
+      {
+         if( replayService( &sim, REPLAY_IDLE ) == True )
+         {
+            continue;
+         }
+      }
+      else if( coreFree == True && interruptBatchDue( configDataPtr,
+            sim.pendingCount, sim.clockUs - sim.pendingSinceUs, True ) )
+      {
+         serviceInterrupts( &sim );
+         continue;
+      }
+
+      //nothing left to happen, every remaining process is stuck, unless a
+      //replay holds interrupts its recording will never release
+      if( eventQueueIsEmpty( &sim.eventQueue ) )
+      {
+         if( sim.replay != NULL && sim.pendingCount > 0 )
+         {
+            replayService( &sim, REPLAY_STUCK );
+            continue;
+         }
+         break;
+      }
+
+      //advance the virtual clock to the next event, and dispatch it, with
+      //every other event at the same time, so the next pass sees them all
+      PROFILE_BEGIN( PROF_CALENDAR );
+      simEvent = eventQueuePop( &sim.eventQueue );
+      PROFILE_END( PROF_CALENDAR );
+      sim.clockUs = simEvent.timeUs;
+      metricsSet( configDataPtr, METRIC_SIM_TIME_US, sim.clockUs );
+      while( True )
+      {
+         sim.eventCount++;
+         handleSimEvent( &sim, simEvent );
+         if( eventQueueIsEmpty( &sim.eventQueue ) == True
+               || eventQueuePeek( &sim.eventQueue ).timeUs != sim.clockUs )
+         {
+            break;
+         }
+         PROFILE_BEGIN( PROF_CALENDAR );
+         simEvent = eventQueuePop( &sim.eventQueue );
+         PROFILE_END( PROF_CALENDAR );
+      }
+   }
+   /////////////////////////////END MAIN EVENT LOOP/////////////////////////////
+
+
+   //EVENT LOG: System Stop
+   logSimEvent( &sim, OS, SystemStop, -1 );
+   traceClose( configDataPtr );
+   metricsClose( configDataPtr );
+
+   //report how busy and contended each I/O device was
+   PROFILE_BEGIN( PROF_REPORT );
+   logDeviceStats( &sim.deviceTable, sim.clockUs, configDataPtr,
+                                                            sim.listHeadPtr );
+   logInterruptStats( &sim.interruptStats, configDataPtr, sim.listHeadPtr );
+   logReplayStats( sim.replay, configDataPtr, sim.listHeadPtr );
+   logLatencyStats( &sim.latencyStats, &sim.deviceTable, configDataPtr,
+                                                            sim.listHeadPtr );
+
+   CoreStats coreStats[ sim.coreCount ];
+   for( indexI = 0; indexI < sim.coreCount; indexI++ )
+   {
+      coreStats[indexI] = sim.cores[indexI].coreStats;
+   }
+   logCoreStats( coreStats, sim.coreCount, sim.clockUs, configDataPtr,
+                                                            sim.listHeadPtr );
+   logSchedulingStats( sim.pcbArray, sim.processCount, coreStats,
+                              sim.coreCount, configDataPtr, sim.listHeadPtr );
+   logOverheadStats( coreStats, sim.coreCount, configDataPtr,
+                                                            sim.listHeadPtr );
+   logDeadlineStats( &sim.deadlineStats, configDataPtr, sim.listHeadPtr );
+   summariseRun( &runSummary, sim.pcbArray, sim.processCount, coreStats,
+                                             sim.coreCount, 0, sim.clockUs );
+   logPerformanceSummary( &runSummary, configDataPtr, sim.listHeadPtr );
+   PROFILE_END( PROF_REPORT );
+
+   if( runSummaryPtr != NULL )
+   {
+      *runSummaryPtr = runSummary;
+   }
+
+   //EXIT with normal operation
+   if( configDataPtr->logToCode != LOGTO_NONE_CODE )
+   {
+      printf("\nEnd Simulation - Complete\n");
+      printf( "==========================\n" );
+   }
+
+   //Check if we need to save of completeLog to a file
+   configCodeToString( configDataPtr->logToCode, checkIfFile );
+   if( compareString( checkIfFile, "Both" ) == STR_EQ
+            || compareString( checkIfFile, "File" ) == STR_EQ)
+   {
+      logToFile( sim.listHeadPtr, configDataPtr );
+      writeSummaryFile( sim.pcbArray, sim.processCount, 0 );
+   }
+   PROFILE_END( PROF_RUN );
+   printProfileStats();
+
+   //clear out our logLinkedList, MMU, calendar and PCBs
+   destructSimulation( &sim );
+
+   //safe return from eventSimulationRunner
+   return 0;
+}
+
+/*
+Function name: seedMetrics
+Algorithm: counts the processes in each state, the I/O requests and held
+            interrupts outstanding, and the MMU table's entries, for the
+            metrics socket
+Precondition: sim ready for its first pass, at time zero or restored
+Postcondition: metrics set to the run's state
+Exceptions: none
+Notes: from here on each value moves with the change it counts
+*/
+void seedMetrics( EventSimulation* sim )
+{
+   MMU* mmuPtr;
+   int index;
+
+   for( index = 0; index < sim->processCount; index++ )
+   {
+      metricsAdd( sim->configDataPtr,
+                  METRIC_PROCESSES_NEW + sim->pcbArray[index].pState, 1 );
+      if( sim->pcbArray[index].ioRequest != NULL )
+      {
+         metricsAdd( sim->configDataPtr, METRIC_IO_IN_FLIGHT, 1 );
+      }
+   }
+
+   for( mmuPtr = sim->mmuHeadPtr->next; mmuPtr != NULL; mmuPtr = mmuPtr->next )
+   {
+      metricsAdd( sim->configDataPtr, METRIC_MMU_ENTRIES, 1 );
+   }
+
+   metricsSet( sim->configDataPtr, METRIC_INTERRUPT_QUEUE, sim->pendingCount );
+   metricsSet( sim->configDataPtr, METRIC_SIM_TIME_US, sim->clockUs );
+}
+
+/*
+Function name: destructSimulation
+Algorithm: frees the log, MMU table, calendar, devices, run queues, cores
+            and PCBs of a run, with any I/O request still holding a channel
+Precondition: sim built by eventSimulationRunner
+Postcondition: memory freed
+Exceptions: none
+Notes: queued requests are freed with their device, a run that ends with
+       every process done holds no requests at all
+*/
+void destructSimulation( EventSimulation* sim )
+{
+   IORequest* request;
+   int index;
+
+   recordClose( &sim->recorder );
+   sim->replay = replayDestruct( sim->replay );
+   sim->listHeadPtr = clearLinkedList( sim->listHeadPtr );
+   sim->mmuHeadPtr = clearMMU( sim->mmuHeadPtr );
+   eventQueueDestruct( &sim->eventQueue );
+   deviceTableDestruct( &sim->deviceTable );
+   free( sim->pendingInterrupts );
+   free( sim->pendingRaisedUs );
+   for( index = 0; index < sim->coreCount; index++ )
+   {
+      schedulerDestruct( &sim->schedulers[index] );
+   }
+   for( index = 0; index < sim->processCount; index++ )
+   {
+      request = sim->pcbArray[index].ioRequest;
+      if( request != NULL && request->granted == True )
+      {
+         free( request );
+      }
+   }
+   free( sim->schedulers );
+   free( sim->cores );
+   free( sim->pcbArray );
+}
+
+/*
+Function name: dispatchProcess
+Algorithm: asks the coreScheduler for the next process on the core, logs the
+            steal if it came from another core, and the selection when it
+            differs from the last one the core dispatched, sets it RUNNING
+            and starts its current op, or schedules the start after any
+            dispatch overhead
+Precondition: core is free (no running process)
+Postcondition: returns True if a process was dispatched, False if none READY
+Exceptions: none
+Notes: none
+*/
+Boolean dispatchProcess( EventSimulation* sim, int coreId )
+{
+   PCB* pcbArray = sim->pcbArray;
+   SimCore* core = &sim->cores[ coreId ];
+   char timeString[MAX_STR_LEN];
+   EventData eventData;
+   int scheduledProcess;
+   int victimCore = -1;
+   long long overheadUs;
+   Boolean switchedFlag = False;
+   Boolean coresBusy[ sim->coreCount ];
+   int indexI;
+
+   for( indexI = 0; indexI < sim->coreCount; indexI++ )
+   {
+      coresBusy[ indexI ] = sim->cores[ indexI ].runningProcess != -1
+                                                            ? True : False;
+   }
+
+   //decisions are not timed into the log, whose every line follows from
+   //the virtual clock, their host time is in the profiler's report
+   PROFILE_BEGIN( PROF_SCHEDULER );
+   scheduledProcess = coreScheduler( sim->schedulers, sim->coreCount,
+                                 pcbArray, coresBusy, coreId, &victimCore );
+   PROFILE_END( PROF_SCHEDULER );
+
+   //ensure our scheduler picked a valid process
+   if( scheduledProcess < 0 || pcbArray[scheduledProcess].pState != READY )
+   {
+      return False;
+   }
+   metricsAdd( sim->configDataPtr, METRIC_SCHED_DECISIONS, 1 );
+
+   //EVENT LOG: Process stolen from the run queue of victimCore
+   if( victimCore >= 0 )
+   {
+      core->coreStats.steals++;
+      virtualTimeToString( sim->clockUs, timeString );
+      eventData = generateEventData( OS, ProcStolen, timeString,
+                                    pcbArray[scheduledProcess].programCounter,
+                                                &pcbArray[scheduledProcess] );
+      eventData.stolenFrom = victimCore;
+      eventLogger( eventData, sim->configDataPtr, sim->listHeadPtr );
+   }
+
+   //EVENT LOG: ProcessSelected with Remaining time, if it is a new process
+   if( scheduledProcess != core->lastDispatched )
+   {
+      switchedFlag = True;
+      core->lastDispatched = scheduledProcess;
+      logSimEvent( sim, OS, ProcSelected, scheduledProcess );
+   }
+
+   //EVENT LOG: select process and set in RUNNING
+   setProcessState( sim->configDataPtr, &pcbArray[scheduledProcess], RUNNING );
+   core->runningProcess = scheduledProcess;
+   core->busySinceUs = sim->clockUs;
+   markDispatched( &core->coreStats, &pcbArray[scheduledProcess],
+                                                               sim->clockUs );
+   logSimEvent( sim, OS, ProcSetIn, scheduledProcess );
+
+   //pay for the dispatch on the calendar, the op starts once it is done
+   overheadUs = chargeDispatch( &core->coreStats, &pcbArray[scheduledProcess],
+                                    coreId, switchedFlag, sim->configDataPtr );
+   if( overheadUs > 0 )
+   {
+      //EVENT LOG: context switch overhead
+      virtualTimeToString( sim->clockUs, timeString );
+      eventData = generateEventData( OS, ContextSwitch, timeString,
+                                    pcbArray[scheduledProcess].programCounter,
+                                                &pcbArray[scheduledProcess] );
+      eventData.overheadUs = overheadUs;
+      eventLogger( eventData, sim->configDataPtr, sim->listHeadPtr );
+
+      eventQueuePush( &sim->eventQueue, sim->clockUs + overheadUs,
+                                          EV_DISPATCH_DONE, scheduledProcess );
+      return True;
+   }
+
+   startOperation( sim, scheduledProcess );
+
+   return True;
+}
+
+/*
+Function name: releaseCore
+Algorithm: frees the core a process is running on, and adds the time since
+            it was dispatched to the core's busy time
+Precondition: pId is RUNNING on its home core
+Postcondition: the core is free for the next dispatch
+Exceptions: none
+Notes: none
+*/
+void releaseCore( EventSimulation* sim, int pId )
+{
+   SimCore* core = &sim->cores[ sim->pcbArray[pId].homeCore ];
+
+   core->coreStats.busyUs += sim->clockUs - core->busySinceUs;
+   core->runningProcess = -1;
+}
+
+/*
+Function name: startOperation
+Algorithm: starts the op at the program counter of a RUNNING process.
+            P ops place an op completion (or quantum expiry, when the policy
+            gives a time slice shorter than the op) on the calendar, I/O
+            ops block the process and place an I/O interrupt on the
+            calendar, M ops and A(end) complete immediately.
+Precondition: pId is the RUNNING process
+Postcondition: CPU is either busy until a calendar event, or free again
+Exceptions: none
+Notes: remaining times are charged the same way operationRunner charges them
+*/
+void startOperation( EventSimulation* sim, int pId )
+{
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+   PCB* process = &sim->pcbArray[pId];
+   OpCodeType* programCounter = process->programCounter;
+   Scheduler* scheduler = &sim->schedulers[ process->homeCore ];
+   int sliceMs = 0;
+   int quantumMs = 0;
+   int segFaultFlag = 0;
+   MMU mmuData;
+
+   //RUN OPERATIONS
+   if( programCounter->opLtr == 'P' )
+   {
+      //fresh op, log its start, a resumed op carries its remaining time
+      if( process->opRemainingMs == 0 )
+      {
+         //EVENT LOG: run start
+         logSimEvent( sim, Process, ProcOpStart, pId );
+         process->opRemainingMs =
+               programCounter->opValue * configDataPtr->procCycleRate;
+      }
+
+      sliceMs = process->opRemainingMs;
+      quantumMs = schedulerTimeSlice( scheduler, process );
+
+      //a time sliced policy only gives a quantum worth of the op before it
+      //is preempted
+      if( quantumMs > 0 && sliceMs > quantumMs )
+      {
+         sliceMs = quantumMs;
+         eventQueuePush( &sim->eventQueue, sim->clockUs + sliceMs * 1000LL,
+                                                      EV_QUANTUM_EXPIRY, pId );
+      }
+      else
+      {
+         eventQueuePush( &sim->eventQueue, sim->clockUs + sliceMs * 1000LL,
+                                                         EV_OP_COMPLETE, pId );
+      }
+
+      process->sliceMs = quantumMs;
+   }
+
+   //MEMORY OPERATIONS
+   else if( programCounter->opLtr == 'M' )
+   {
+      mmuData = getMemoryRequest( pId, programCounter->opValue );
+      process->mmuInfo = mmuData;
+
+      //Check memory action type (allocate, access) and call to appropriate func
+      if( compareString( programCounter->opName, "allocate" ) == STR_EQ )
+      {
+         //EVENT LOG: mem attempt to allocate, then success or failure
+         logSimEvent( sim, Process, MMUAllocAttempt, pId );
+         segFaultFlag = mmuAllocate( configDataPtr, sim->mmuHeadPtr,
+                                                   sim->mmuHeadPtr, mmuData );
+         logSimEvent( sim, Process,
+               segFaultFlag == 0 ? MMUAllocSuccess : MMUAllocFailed, pId );
+      }
+      else
+      {
+         //EVENT LOG: mem attempt to access, then success or failure
+         logSimEvent( sim, Process, MMUAccessAttempt, pId );
+         segFaultFlag = mmuAccess( configDataPtr, sim->mmuHeadPtr,
+                                                   sim->mmuHeadPtr, mmuData );
+         logSimEvent( sim, Process,
+               segFaultFlag == 0 ? MMUAccessSuccess : MMUAccessFailed, pId );
+      }
+
+      if( segFaultFlag != 0 )
+      {
+         //EVENT LOG: segfault, process experiences, and is ended
+         logSimEvent( sim, OS, SegFault, pId );
+         exitProcess( sim, pId );
+         return;
+      }
+
+      //memory ops take no simulated time, move on to the next op
+      process->programCounter = programCounter->next;
+      releaseCore( sim, pId );
+      schedulerPreempt( scheduler, process, 0, False );
+      makeReady( sim->configDataPtr, sim->schedulers, process, sim->clockUs );
+   }
+
+   //I/O OPERATIONS
+   else if( programCounter->opLtr == 'I' || programCounter->opLtr == 'O' )
+   {
+      //EVENT LOG: io start
+      logSimEvent( sim, Process, ProcOpStart, pId );
+
+      sliceMs = programCounter->opValue * configDataPtr->ioCycleRate;
+
+      //queue on the named device, the interrupt is only placed on the
+      //calendar once the request holds one of the device channels
+      process->ioRequest = createIORequest( pId,
+                  getDeviceCode( programCounter->opName ),
+                  getDiskCylinder( pId, process->ioCount++,
+                                             configDataPtr->diskCylinders ),
+                                          sim->clockUs, sliceMs * 1000LL );
+      metricsAdd( sim->configDataPtr, METRIC_IO_IN_FLIGHT, 1 );
+      if( deviceSubmit( &sim->deviceTable.devices[
+                                          process->ioRequest->deviceCode ],
+                                    process->ioRequest, sim->clockUs ) == True )
+      {
+         eventQueuePush( &sim->eventQueue, replayIoDone( sim, pId,
+                        sim->clockUs + process->ioRequest->serviceUs ),
+                                                         EV_IO_INTERRUPT, pId );
+      }
+
+      //place our process in blocked, the interrupt event will unblock it
+      setProcessState( sim->configDataPtr, process, BLOCKED );
+      process->blockedSinceUs = sim->clockUs;
+      schedulerBlock( scheduler, process, 0 );
+      logSimEvent( sim, OS, ProcBlocked, pId );
+
+      //charge the I/O time now, as operationRunner does
+      if( scheduler->policy->preemptive == True )
+      {
+         process->remainingTimeMs -= sliceMs;
+         if( process->remainingTimeMs < 0 )
+         {
+            process->remainingTimeMs = 0;
+         }
+      }
+
+      process->programCounter = programCounter->next;
+      releaseCore( sim, pId );
+   }
+
+   //APPLICATION END, this will only ever be A(end)0
+   else
+   {
+      exitProcess( sim, pId );
+   }
+}
+
+/*
+Function name: handleSimEvent
+Algorithm: applies one calendar event to the simulation state
+Precondition: virtual clock already advanced to the event time
+Postcondition: process states updated, CPU freed where an op finished
+Exceptions: none
+Notes: a process coming off the CPU is charged its run before it is queued
+       again, so the policy sees its new remaining time
+*/
+void handleSimEvent( EventSimulation* sim, SimEvent simEvent )
+{
+   PCB* process = NULL;
+   Scheduler* scheduler = NULL;
+   int sliceMs = 0;
+   Boolean requeueFlag = False;
+   IORequest* nextRequest = NULL;
+
+   //OS wide events, such as the coalescing timer, carry no process
+   if( simEvent.pId >= 0 )
+   {
+      process = &sim->pcbArray[simEvent.pId];
+      scheduler = &sim->schedulers[ process->homeCore ];
+   }
+
+   switch( simEvent.eventType )
+   {
+      //process enters the system and waits for the scheduler
+      case EV_PROCESS_ARRIVAL:
+         makeReady( sim->configDataPtr, sim->schedulers, process,
+                                                               sim->clockUs );
+         if( sim->staggeredArrivals == True )
+         {
+            logSimEvent( sim, OS, ProcArrived, simEvent.pId );
+         }
+         break;
+
+      //P op ran to the end, log it and step the program counter
+      case EV_OP_COMPLETE:
+         sliceMs = process->opRemainingMs;
+         process->opRemainingMs = 0;
+         histogramRecord( &sim->latencyStats.opRunUs, sliceMs * 1000LL );
+
+         //EVENT LOG: run end
+         logSimEvent( sim, Process, ProcOpEnd, simEvent.pId );
+         process->programCounter = process->programCounter->next;
+         releaseCore( sim, simEvent.pId );
+         requeueFlag = True;
+         break;
+
+      //P op used up its quantum, back to READY with the rest still to run
+      case EV_QUANTUM_EXPIRY:
+         sliceMs = process->sliceMs;
+         process->opRemainingMs -= sliceMs;
+         histogramRecord( &sim->latencyStats.opRunUs, sliceMs * 1000LL );
+         releaseCore( sim, simEvent.pId );
+         requeueFlag = True;
+
+         //EVENT LOG: quantum expired
+         logSimEvent( sim, OS, ProcPreempted, simEvent.pId );
+         break;
+
+      //I/O finished, free its channel for the next queued request on the
+      //device, and unblock the process
+      case EV_IO_INTERRUPT:
+         nextRequest = deviceComplete( &sim->deviceTable.devices[
+                                             process->ioRequest->deviceCode ],
+                                          process->ioRequest, sim->clockUs );
+         if( nextRequest != NULL )
+         {
+            eventQueuePush( &sim->eventQueue,
+                  replayIoDone( sim, nextRequest->pId,
+                                 sim->clockUs + nextRequest->serviceUs ),
+                                          EV_IO_INTERRUPT, nextRequest->pId );
+         }
+         free( process->ioRequest );
+         process->ioRequest = NULL;
+         metricsAdd( sim->configDataPtr, METRIC_IO_IN_FLIGHT, -1 );
+         raiseInterrupt( sim, simEvent.pId );
+         break;
+
+      //coalescing window ran out, service the batch if it is the one this
+      //timer was set for, a later batch has its own timer. A replay sets
+      //the timer for the recorded time of its next dequeue
+      case EV_INTERRUPT_FLUSH:
+         if( sim->replay != NULL )
+         {
+            replayService( sim, REPLAY_FLUSH );
+         }
+         else if( interruptBatchDue( sim->configDataPtr, sim->pendingCount,
+                                 sim->clockUs - sim->pendingSinceUs, False ) )
+         {
+            PROFILE_BEGIN( PROF_INTERRUPTS );
+            serviceInterrupts( sim );
+            PROFILE_END( PROF_INTERRUPTS );
+         }
+         break;
+
+      //dispatch overhead paid, the process starts its current op
+      case EV_DISPATCH_DONE:
+         startOperation( sim, simEvent.pId );
+         break;
+   }
+
+   //check if we had timeRemoved, and if we are in a PRE-EMPTIVE policy
+   if( sliceMs > 0 && scheduler->policy->preemptive == True )
+   {
+      process->remainingTimeMs -= sliceMs;
+
+      //bound to zero, if it drops below
+      if( process->remainingTimeMs < 0 )
+      {
+         process->remainingTimeMs = 0;
+      }
+   }
+
+   //back in the run queue, once the policy has seen how long it ran
+   if( requeueFlag == True )
+   {
+      schedulerPreempt( scheduler, process, sliceMs,
+                        process->sliceMs > 0 && sliceMs >= process->sliceMs );
+      makeReady( sim->configDataPtr, sim->schedulers, process, sim->clockUs );
+   }
+}
+
+/*
+Function name: exitProcess
+Algorithm: places a process in EXIT, logs it, and frees the CPU
+Precondition: pId is the RUNNING process
+Postcondition: exit count incremented
+Exceptions: none
+Notes: none
+*/
+void exitProcess( EventSimulation* sim, int pId )
+{
+   char timeString[MAX_STR_LEN];
+   EventData eventData;
+   long long latenessUs;
+
+   setProcessState( sim->configDataPtr, &sim->pcbArray[pId], EXIT );
+   sim->pcbArray[pId].completionUs = sim->clockUs;
+   sim->exitCount++;
+   releaseCore( sim, pId );
+   schedulerExit( &sim->schedulers[ sim->pcbArray[pId].homeCore ],
+                                                      &sim->pcbArray[pId], 0 );
+
+   //EVENT LOG: process ended past its deadline
+   latenessUs = checkDeadline( &sim->deadlineStats, &sim->pcbArray[pId],
+                                                               sim->clockUs );
+   if( latenessUs > 0 )
+   {
+      virtualTimeToString( sim->clockUs, timeString );
+      eventData = generateEventData( OS, DeadlineMissed, timeString,
+                     sim->pcbArray[pId].programCounter, &sim->pcbArray[pId] );
+      eventData.latenessUs = latenessUs;
+      eventLogger( eventData, sim->configDataPtr, sim->listHeadPtr );
+   }
+
+   //EVENT LOG: end process and set in EXIT
+   logSimEvent( sim, OS, ProcEnd, pId );
+}
+
+/*
+Function name: raiseInterrupt
+Algorithm: services the interrupt straight away, unless coalescing is on,
+            in which case it is held with the pending batch. The first
+            interrupt of a batch starts the window timer, and a batch that
+            reaches the count threshold is serviced at once
+Precondition: pId has just finished its I/O, and is still BLOCKED
+Postcondition: process READY, or BLOCKED until its batch is serviced
+Exceptions: none
+Notes: none
+*/
+void raiseInterrupt( EventSimulation* sim, int pId )
+{
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+   PROFILE_BEGIN( PROF_INTERRUPTS );
+
+   recordInterrupt( &sim->recorder, RECORD_ENQUEUE, pId, sim->clockUs );
+
+   //a replay services it when the recording does
+   if( sim->replay != NULL )
+   {
+      replayInterrupt( sim, pId );
+      PROFILE_END( PROF_INTERRUPTS );
+      return;
+   }
+
+   if( interruptCoalescing( configDataPtr ) == False )
+   {
+      recordInterrupt( &sim->recorder, RECORD_DEQUEUE, pId, sim->clockUs );
+      histogramRecord( &sim->latencyStats.interruptUs, 0 );
+      makeReady( sim->configDataPtr, sim->schedulers, &sim->pcbArray[pId],
+                                                               sim->clockUs );
+      sim->interruptStats.serviced++;
+      sim->interruptStats.batches++;
+      sim->interruptStats.maxBatch = 1;
+
+      //EVENT LOG: Interrupt Called by Process
+      logSimEvent( sim, OS, Interrupt, pId );
+      PROFILE_END( PROF_INTERRUPTS );
+      return;
+   }
+
+   //first of a new batch, start its window
+   if( sim->pendingCount == 0 )
+   {
+      sim->pendingSinceUs = sim->clockUs;
+      if( configDataPtr->intCoalesceWindowMs > 0 )
+      {
+         eventQueuePush( &sim->eventQueue,
+               sim->clockUs + configDataPtr->intCoalesceWindowMs * 1000LL,
+                                                   EV_INTERRUPT_FLUSH, -1 );
+      }
+   }
+
+   sim->pendingInterrupts[ sim->pendingCount ] = pId;
+   sim->pendingRaisedUs[ sim->pendingCount ] = sim->clockUs;
+   sim->pendingCount++;
+   metricsSet( sim->configDataPtr, METRIC_INTERRUPT_QUEUE, sim->pendingCount );
+
+   if( configDataPtr->intCoalesceCount > 1
+                  && sim->pendingCount >= configDataPtr->intCoalesceCount )
+   {
+      serviceInterrupts( sim );
+   }
+
+   PROFILE_END( PROF_INTERRUPTS );
+}
+
+/*
+Function name: serviceInterrupts
+Algorithm: one pass of the interrupt handler, every pending interrupt is
+            serviced in the order raised and its process set READY
+Precondition: at least one pending interrupt
+Postcondition: no pending interrupts, batch totals updated
+Exceptions: none
+Notes: none
+*/
+void serviceInterrupts( EventSimulation* sim )
+{
+   char timeString[MAX_STR_LEN];
+   EventData eventData;
+   int index;
+
+   sim->interruptStats.serviced += sim->pendingCount;
+   sim->interruptStats.batches++;
+   if( sim->pendingCount > sim->interruptStats.maxBatch )
+   {
+      sim->interruptStats.maxBatch = sim->pendingCount;
+   }
+
+   //EVENT LOG: Interrupt batch of pendingCount
+   virtualTimeToString( sim->clockUs, timeString );
+   eventData = generateEventData( OS, InterruptBatch, timeString, NULL, NULL );
+   eventData.batchSize = sim->pendingCount;
+   eventLogger( eventData, sim->configDataPtr, sim->listHeadPtr );
+
+   for( index = 0; index < sim->pendingCount; index++ )
+   {
+      histogramRecord( &sim->latencyStats.interruptUs,
+                           sim->clockUs - sim->pendingRaisedUs[ index ] );
+      recordInterrupt( &sim->recorder,
+                        index == 0 ? RECORD_BATCH : RECORD_DEQUEUE,
+                              sim->pendingInterrupts[ index ], sim->clockUs );
+      makeReady( sim->configDataPtr, sim->schedulers,
+                        &sim->pcbArray[ sim->pendingInterrupts[ index ] ],
+                                                               sim->clockUs );
+
+      //EVENT LOG: Interrupt Called by Process
+      logSimEvent( sim, OS, Interrupt, sim->pendingInterrupts[ index ] );
+   }
+
+   sim->pendingCount = 0;
+   metricsSet( sim->configDataPtr, METRIC_INTERRUPT_QUEUE, 0 );
+}
+
+/*
+Function name: logSimEvent
+Algorithm: stamps an event with the virtual clock and sends it to the
+            eventLogger, the same way the real time runner does
+Precondition: pId of the process involved, or -1 for OS wide events
+Postcondition: event logged
+Exceptions: none
+Notes: none
+*/
+void logSimEvent( EventSimulation* sim, EventType eventType, LogCode logCode,
+                                                                      int pId )
+{
+   char timeString[MAX_STR_LEN];
+   EventData eventData;
+
+   virtualTimeToString( sim->clockUs, timeString );
+
+   if( pId < 0 )
+   {
+      eventData = generateEventData( eventType, logCode, timeString,
+                                                                  NULL, NULL );
+   }
+   else
+   {
+      eventData = generateEventData( eventType, logCode, timeString,
+                                       sim->pcbArray[pId].programCounter,
+                                                         &sim->pcbArray[pId] );
+   }
+
+   eventLogger( eventData, sim->configDataPtr, sim->listHeadPtr );
+}
+
+/*
+Function name: virtualTimeToString
+Algorithm: splits the virtual clock into seconds and micro-seconds, and
+            formats it the same way accessTimer formats lap times
+Precondition: timeString has room for the formatted time
+Postcondition: timeString holds the formatted time
+Exceptions: none
+Notes: none
+*/
+void virtualTimeToString( long long timeUs, char* timeString )
+{
+   timeToString( (int) ( timeUs / 1000000 ), (int) ( timeUs % 1000000 ),
+                                                                  timeString );
+}
@@ -0,0 +1,206 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Histogram.c
+ *
+ *
+ * @version 5.45
+ *          Kristopher Moore (19 October 2026)
+ *          Fixed memory, log bucketed latency histograms.
+ */
+
+#include "Histogram.h"
+
+/*
+Function name: highestBit
+Algorithm: finds the position of the highest set bit
+Precondition: value greater than zero
+Postcondition: returns the bit position, 0 for the lowest bit
+Exceptions: none
+Notes: uses the compiler's count leading zeros where there is one
+*/
+static int highestBit( unsigned long long value )
+{
+#ifdef __GNUC__
+   return 63 - __builtin_clzll( value );
+#else
+   int position = 0;
+
+   while( value >>= 1 )
+   {
+      position++;
+   }
+
+   return position;
+#endif
+}
+
+/*
+Function name: bucketIndex
+Algorithm: values below the sub bucket count index directly, larger values
+            index by their power of two and their next highest bits
+Precondition: value not negative
+Postcondition: returns the bucket holding the value
+Exceptions: none
+Notes: none
+*/
+static int bucketIndex( long long value )
+{
+   int shift;
+
+   if( value < HIST_SUB_COUNT )
+   {
+      return (int) value;
+   }
+
+   shift = highestBit( (unsigned long long) value ) - ( HIST_SUB_BITS - 1 );
+
+   return HIST_SUB_COUNT + ( shift - 1 ) * HIST_HALF_COUNT
+                           + (int) ( value >> shift ) - HIST_HALF_COUNT;
+}
+
+/*
+Function name: bucketHighest
+Algorithm: inverts bucketIndex, for the largest value a bucket holds
+Precondition: index within the bucket count
+Postcondition: returns the highest value counted by the bucket
+Exceptions: none
+Notes: percentiles report this, so they never understate a latency
+*/
+static long long bucketHighest( int index )
+{
+   int shift;
+   long long top;
+
+   if( index < HIST_SUB_COUNT )
+   {
+      return index;
+   }
+
+   shift = ( index - HIST_SUB_COUNT ) / HIST_HALF_COUNT + 1;
+   top = ( index - HIST_SUB_COUNT ) % HIST_HALF_COUNT + HIST_HALF_COUNT;
+
+   return ( ( top + 1 ) << shift ) - 1;
+}
+
+/*
+Function name: histogramInit
+Algorithm: clears every bucket and the totals
+Precondition: pointer to a histogram
+Postcondition: histogram empty
+Exceptions: none
+Notes: none
+*/
+void histogramInit( LatencyHistogram* histogram )
+{
+   int index;
+
+   for( index = 0; index < HIST_BUCKET_COUNT; index++ )
+   {
+      histogram->counts[ index ] = 0;
+   }
+
+   histogram->totalCount = 0;
+   histogram->totalValue = 0;
+   histogram->minValue = 0;
+   histogram->maxValue = 0;
+}
+
+/*
+Function name: histogramRecord
+Algorithm: counts the value in its bucket, and adds it to the totals
+Precondition: initialized histogram
+Postcondition: value recorded
+Exceptions: negative values are recorded as zero
+Notes: O(1)
+*/
+void histogramRecord( LatencyHistogram* histogram, long long value )
+{
+   if( value < 0 )
+   {
+      value = 0;
+   }
+
+   histogram->counts[ bucketIndex( value ) ]++;
+
+   if( histogram->totalCount == 0 || value < histogram->minValue )
+   {
+      histogram->minValue = value;
+   }
+
+   if( value > histogram->maxValue )
+   {
+      histogram->maxValue = value;
+   }
+
+   histogram->totalCount++;
+   histogram->totalValue += value;
+}
+
+/*
+Function name: histogramPercentile
+Algorithm: walks the buckets to the nearest rank of the percentile
+Precondition: percentile from 0 to 100
+Postcondition: returns the highest value of the bucket holding the rank,
+               bounded by the smallest and largest values recorded
+Exceptions: returns 0 if nothing has been recorded
+Notes: O(buckets)
+*/
+long long histogramPercentile( LatencyHistogram* histogram,
+                                                         double percentile )
+{
+   long long rank;
+   long long seen = 0;
+   long long value;
+   int index;
+
+   if( histogram->totalCount == 0 )
+   {
+      return 0;
+   }
+
+   rank = (long long) ( percentile / 100.0 * histogram->totalCount + 0.999999 );
+   if( rank < 1 )
+   {
+      rank = 1;
+   }
+
+   for( index = 0; index < HIST_BUCKET_COUNT; index++ )
+   {
+      seen += histogram->counts[ index ];
+      if( seen >= rank )
+      {
+         break;
+      }
+   }
+
+   value = bucketHighest( index );
+   if( value > histogram->maxValue )
+   {
+      value = histogram->maxValue;
+   }
+
+   if( value < histogram->minValue )
+   {
+      value = histogram->minValue;
+   }
+
+   return value;
+}
+
+/*
+Function name: histogramMean
+Algorithm: divides the exact total by the count
+Precondition: initialized histogram
+Postcondition: returns the mean of every value recorded
+Exceptions: returns 0 if nothing has been recorded
+Notes: none
+*/
+double histogramMean( LatencyHistogram* histogram )
+{
+   if( histogram->totalCount == 0 )
+   {
+      return 0.0;
+   }
+
+   return (double) histogram->totalValue / histogram->totalCount;
+}
@@ -0,0 +1,42 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file Histogram.h
+ *
+ * @version 5.45
+ *          Kristopher Moore (19 October 2026)
+ *          Fixed memory, log bucketed latency histograms.
+ */
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include "StringUtils.h"
+
+//values below HIST_SUB_COUNT get a bucket each, above that every power of
+//two is split into HIST_HALF_COUNT buckets, so a bucket is within 1/64,
+//about 1.6%, of any value in it
+#define HIST_SUB_BITS 7
+#define HIST_SUB_COUNT ( 1 << HIST_SUB_BITS )
+#define HIST_HALF_COUNT ( HIST_SUB_COUNT / 2 )
+#define HIST_BUCKET_COUNT \
+                  ( HIST_SUB_COUNT + ( 63 - HIST_SUB_BITS ) * HIST_HALF_COUNT )
+
+//counts of non-negative values, recording is O(1) and never allocates
+typedef struct
+{
+   long long counts[ HIST_BUCKET_COUNT ];
+   long long totalCount;
+   long long totalValue;
+   long long minValue;
+   long long maxValue;
+
+} LatencyHistogram;
+
+//function prototypes
+void histogramInit( LatencyHistogram* histogram );
+void histogramRecord( LatencyHistogram* histogram, long long value );
+long long histogramPercentile( LatencyHistogram* histogram,
+                                                         double percentile );
+double histogramMean( LatencyHistogram* histogram );
+
+#endif // HISTOGRAM_H
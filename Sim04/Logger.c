@@ -26,15 +26,18 @@ void eventLogger(EventData eventData, ConfigDataType* configDataPtr,
 {
    //inits / declare strings holders
    LogLinkedList* newNodePtr = NULL;
-   LogLinkedList* oldNodePtr = NULL;
    char finalLogStr[MAX_STR_LEN];
+   char logLineStr[MAX_STR_LEN + 2];
    char eventStr[MAX_STR_LEN];
    char logCodeStr[MAX_STR_LEN];
    char logCodeExtend[MAX_STR_LEN];
    char monitorString[STD_STR_LEN];
+   char coreStr[STD_STR_LEN];
+   PROFILE_BEGIN( PROF_EVENT_LOGGER );
    
    //full out any garbage
    copyString( finalLogStr, " " );
+   coreStr[ 0 ] = NULL_CHAR;
    copyString( eventStr, " " );
    copyString( logCodeStr, " " );
    copyString( logCodeExtend, " " );
@@ -77,11 +80,21 @@ void eventLogger(EventData eventData, ConfigDataType* configDataPtr,
                               "All processes initialized in READY state\n" );
          break;
          
+      case ProcArrived:
+         sprintf( logCodeStr, "Process %d arrived and set in READY state\n",
+                                                               eventData.pId );
+         break;
+         
       case Interrupt:
          sprintf( logCodeStr, "Interrupt called by Process %d\n",
                                                                eventData.pId );
          break;
       
+      case InterruptBatch:
+         sprintf( logCodeStr, "Interrupt batch of %d serviced\n",
+                                                         eventData.batchSize );
+         break;
+      
       case ProcOpStart:
          sprintf( logCodeStr, "%s start\n", eventData.opType );
          break;
@@ -105,6 +118,28 @@ void eventLogger(EventData eventData, ConfigDataType* configDataPtr,
                                                                eventData.pId );
          break;
          
+      case ProcPreempted:
+         sprintf( logCodeStr, 
+                  "Process %d quantum expired, set in READY state\n",
+                                                               eventData.pId );
+         break;
+      
+      case ProcStolen:
+         sprintf( logCodeStr, "Process %d stolen from core %d\n",
+                                       eventData.pId, eventData.stolenFrom );
+         break;
+         
+      case ContextSwitch:
+         sprintf( logCodeStr, 
+                     "Context switch to Process %d, %.3f ms overhead\n",
+                              eventData.pId, eventData.overheadUs / 1000.0 );
+         break;
+         
+      case DeadlineMissed:
+         sprintf( logCodeStr, "Process %d missed its deadline by %.3f ms\n",
+                              eventData.pId, eventData.latenessUs / 1000.0 );
+         break;
+         
       case ProcEnd:
          sprintf( logCodeStr, 
                     "Process %d ended and set in EXIT state\n\n", eventData.pId );
@@ -163,45 +198,58 @@ void eventLogger(EventData eventData, ConfigDataType* configDataPtr,
       
    }
    
+   //tag events with the core of their process, once there is a choice
+   if( configDataPtr->cpuCores > 1 && eventData.coreId >= 0 )
+   {
+      sprintf( coreStr, " Core %d,", eventData.coreId );
+   }
+   
    //concat the strings
    concatenateString( finalLogStr, "\t" );
    concatenateString( finalLogStr, eventData.timeToPrint );
    concatenateString( finalLogStr, "," );
+   concatenateString( finalLogStr, coreStr );
    concatenateString( finalLogStr, eventStr );
    concatenateString( finalLogStr, logCodeStr );
    concatenateString( finalLogStr, logCodeExtend );
    
-   //NOW, we need to add the string to our linkedList.
-   //allocate space, and ensure we intialize it
-   newNodePtr = ( LogLinkedList * ) malloc( sizeof( LogLinkedList ) );
-   copyString( newNodePtr->logLine, " " );
-     
-   //add node and adjust ptr
-   listCurrentPtr = addNodeLL( listCurrentPtr, newNodePtr );
-   listCurrentPtr = listCurrentPtr->next;
-      
-   //Get last node position, so we can set it
-   while( listCurrentPtr != NULL )
-   {
-      oldNodePtr = listCurrentPtr;
-      listCurrentPtr = listCurrentPtr->next;
-   }
-   //set our log string to our linked list
-   copyString( oldNodePtr->logLine, " " );
-   concatenateString( oldNodePtr->logLine, finalLogStr );
-                        
-   free( newNodePtr );
-   
-   
    //convert our code into a string, then check how we should be eventLogging
    configCodeToString( configDataPtr->logToCode, monitorString );
    
+   //NOW, we need to add the string to our linkedList, which is only ever
+   //written out when logging to a file
+   if( compareString( monitorString, "Both" ) == STR_EQ
+            || compareString( monitorString, "File" ) == STR_EQ )
+   {
+      //allocate space for our line, and ensure we intialize it
+      copyString( logLineStr, " " );
+      concatenateString( logLineStr, finalLogStr );
+      newNodePtr = createLogNode( logLineStr );
+      
+      //append after the tail cached on the head node
+      appendNodeLL( listCurrentPtr, newNodePtr );
+   }
+   
    //check if we need to print to screen, and do it.
    if( compareString( monitorString, "Both" ) == STR_EQ
             ||compareString( monitorString, "Monitor" ) == STR_EQ )
    {
       printf( "%s", finalLogStr ); 
    }
+   
+   //stream the event to the trace, when one is being written, and count
+   //it on the metrics socket, when one is being served
+   traceEvent( &eventData, configDataPtr );
+   metricsAdd( configDataPtr, METRIC_EVENTS_LOGGED, 1 );
+
+   //hand the event to an embedding program, when one is listening
+   if( configDataPtr->eventCallback != NULL )
+   {
+      configDataPtr->eventCallback( &eventData,
+                                          configDataPtr->eventUserData );
+   }
+   
+   PROFILE_END( PROF_EVENT_LOGGER );
 }
 
 
@@ -219,6 +267,7 @@ EventData generateEventData( EventType eventType, LogCode logCode,
 {
    EventData eventData;
    char opTypeStr[MAX_STR_LEN];
+   PROFILE_BEGIN( PROF_EVENT_DATA );
    copyString( opTypeStr, " " );
    
    //load parameters into struct
@@ -229,17 +278,26 @@ EventData generateEventData( EventType eventType, LogCode logCode,
    copyString( eventData.opType, " " );
    eventData.pStateStr = "";
    eventData.remainingTime = 0;
+   eventData.batchSize = 0;
+   eventData.coreId = -1;
+   eventData.stolenFrom = -1;
+   eventData.latenessUs = 0;
+   eventData.overheadUs = 0;
+   eventData.opLtr = NULL_CHAR;
+   eventData.deviceCode = -1;
    eventData.pId = -1;
    
    
    //return if our pointer isnt valid, the following calls rely on the process
    if( process == NULL  || programCounter == NULL )
    {
+      PROFILE_END( PROF_EVENT_DATA );
       return eventData;
    }
    
-   //store remaining time
+   //store remaining time, and the core the process is on
    eventData.remainingTime = process->remainingTimeMs;
+   eventData.coreId = process->homeCore;
    
    //check if we have a process id to set
    if( process->pId >= 0 )
@@ -265,7 +323,9 @@ EventData generateEventData( EventType eventType, LogCode logCode,
       concatenateString( opTypeStr, "monitor" );
    }
    
-   //check what our operation type is, if any of these apply
+   //check what our operation type is, if any of these apply, I/O ops also
+   //keep their device for the trace
+   eventData.opLtr = programCounter->opLtr;
    if( programCounter->opLtr == 'P' )
    {
       concatenateString( opTypeStr, "run operation" );
@@ -273,10 +333,12 @@ EventData generateEventData( EventType eventType, LogCode logCode,
    else if( programCounter->opLtr == 'I')
    {
       concatenateString( opTypeStr, " input" );
+      eventData.deviceCode = getDeviceCode( programCounter->opName );
    }
    else if( programCounter->opLtr == 'O')
    {
       concatenateString( opTypeStr, " output" );
+      eventData.deviceCode = getDeviceCode( programCounter->opName );
    }
    
    //copy the concated string into our opType event Data.
@@ -285,6 +347,7 @@ EventData generateEventData( EventType eventType, LogCode logCode,
    //store a copy of our mmuInformation (SS BBB AAA values)
    eventData.mmuData = process->mmuInfo;
    
+   PROFILE_END( PROF_EVENT_DATA );
    return eventData;
 }
 
@@ -300,7 +363,8 @@ Notes: none
 */
 void logToFile( LogLinkedList* listHeadPtr , ConfigDataType* configDataPtr )
 {
-   FILE* filePtr = fopen( "SimulatorLogFile.lgf", "w" );
+   FILE* filePtr = fopen( LOG_FILE_NAME, "w" );
+   PROFILE_BEGIN( PROF_LOG_FILE );
    
    //write header
    fprintf( filePtr, "======================================\n" );
@@ -309,8 +373,8 @@ void logToFile( LogLinkedList* listHeadPtr , ConfigDataType* configDataPtr )
    //write config data
    fprintf( filePtr, "File Name\t\t\t: %s\n", 
                                        configDataPtr->metaDataFileName );
-   fprintf( filePtr, "CPU Scheduling\t\t\t: %d\n", 
-                                       configDataPtr->cpuSchedCode );
+   fprintf( filePtr, "CPU Scheduling\t\t\t: %s\n", 
+                        getSchedulerPolicy( configDataPtr->cpuSchedCode )->name );
    fprintf( filePtr, "Quantum Cycles\t\t\t: %d\n", 
                                        configDataPtr->quantumCycles );
    fprintf( filePtr, "Memory Available (KB)\t\t: %d\n", 
@@ -327,6 +391,777 @@ void logToFile( LogLinkedList* listHeadPtr , ConfigDataType* configDataPtr )
       listHeadPtr = listHeadPtr->next;
    }
    fclose( filePtr );
+   
+   PROFILE_END( PROF_LOG_FILE );
+}
+
+/*
+Function name: reportLogger
+Algorithm: sends one line of an end of run report to the monitor and/or the
+            log linked list, following the same Log To rules as eventLogger
+Precondition: report line and config data
+Postcondition: line printed and/or stored for logToFile
+Exceptions: none
+Notes: report lines carry no timestamp
+*/
+void reportLogger( char* reportLine, ConfigDataType* configDataPtr,
+                                                LogLinkedList* listHeadPtr )
+{
+   LogLinkedList* newNodePtr = NULL;
+   char monitorString[STD_STR_LEN];
+   
+   configCodeToString( configDataPtr->logToCode, monitorString );
+   
+   //store the line if we are logging to a file
+   if( compareString( monitorString, "Both" ) == STR_EQ
+            || compareString( monitorString, "File" ) == STR_EQ )
+   {
+      newNodePtr = createLogNode( reportLine );
+      appendNodeLL( listHeadPtr, newNodePtr );
+   }
+   
+   //check if we need to print to screen, and do it.
+   if( compareString( monitorString, "Both" ) == STR_EQ
+            || compareString( monitorString, "Monitor" ) == STR_EQ )
+   {
+      printf( "%s", reportLine );
+   }
+}
+
+/*
+Function name: logDeviceStats
+Algorithm: reports, for each device that serviced I/O, its request count,
+            channel utilisation, queue wait times and queue lengths
+Precondition: device table used for the run, current clock value
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: nowUs must be on the same clock the device table was started on
+*/
+void logDeviceStats( DeviceTable* deviceTable, long long nowUs,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   char channelStr[STD_STR_LEN];
+   long long elapsedUs = nowUs - deviceTable->startUs;
+   double avgBusy, avgWaitMs, avgQueue;
+   Device* device;
+   int index;
+   
+   //guard against a zero length run
+   if( elapsedUs <= 0 )
+   {
+      elapsedUs = 1;
+   }
+   
+   reportLogger( "\n  Device Statistics\n", configDataPtr, listHeadPtr );
+   
+   for( index = 0; index < DEVICE_COUNT; index++ )
+   {
+      device = &deviceTable->devices[ index ];
+      
+      //skip devices the workload never used
+      if( device->requestCount == 0 )
+      {
+         continue;
+      }
+      
+      //busy channels on average, as a share of the channels if limited
+      avgBusy = (double) device->busyUs / elapsedUs;
+      if( device->channels > 0 )
+      {
+         sprintf( channelStr, "%d channels, %.1f%% busy", device->channels,
+                                       100.0 * avgBusy / device->channels );
+      }
+      else
+      {
+         sprintf( channelStr, "unlimited, %.2f busy", avgBusy );
+      }
+      
+      sprintf( reportLine, "  %-10s: %lld requests, %s\n", device->name,
+                                          device->requestCount, channelStr );
+      reportLogger( reportLine, configDataPtr, listHeadPtr );
+      
+      //queue waits are over every request, queue length over the whole run
+      avgWaitMs = device->totalWaitUs / 1000.0 / device->requestCount;
+      avgQueue = (double) device->queueAreaUs / elapsedUs;
+      sprintf( reportLine, 
+               "     wait avg %.3f ms, max %.3f ms, queue avg %.2f, max %d\n",
+               avgWaitMs, device->maxWaitUs / 1000.0, avgQueue,
+                                                     device->maxQueueLength );
+      reportLogger( reportLine, configDataPtr, listHeadPtr );
+      
+      //the hard drive also reports its arm movement and tail latency
+      if( device->hasDiskArm == True && device->completedCount > 0 )
+      {
+         configCodeToString( device->diskSchedCode, channelStr );
+         sprintf( reportLine,
+               "     disk %s: %.2f req/s, seek avg %.1f cyl %.3f ms\n",
+               channelStr, device->completedCount * 1000000.0 / elapsedUs,
+               (double) device->totalSeekDistance / device->seekCount,
+               device->totalSeekUs / 1000.0 / device->seekCount );
+         reportLogger( reportLine, configDataPtr, listHeadPtr );
+         
+         sprintf( reportLine,
+               "     response p50 %.3f ms, p95 %.3f ms, p99 %.3f ms\n",
+               deviceResponsePercentile( device, 50.0 ) / 1000.0,
+               deviceResponsePercentile( device, 95.0 ) / 1000.0,
+               deviceResponsePercentile( device, 99.0 ) / 1000.0 );
+         reportLogger( reportLine, configDataPtr, listHeadPtr );
+      }
+   }
+}
+
+/*
+Function name: logInterruptStats
+Algorithm: reports how many interrupts were serviced, in how many passes of
+            the interrupt handler, and how many passes batching saved
+Precondition: interrupt totals gathered over the run
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: with coalescing off every interrupt is its own pass, and none are saved
+*/
+void logInterruptStats( InterruptStats* interruptStats,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   
+   //nothing to report for a workload without I/O
+   if( interruptStats->batches == 0 )
+   {
+      return;
+   }
+   
+   reportLogger( "\n  Interrupt Statistics\n", configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, "  %lld interrupts in %lld batches, avg %.2f, max %d\n",
+            interruptStats->serviced, interruptStats->batches,
+            (double) interruptStats->serviced / interruptStats->batches,
+                                                   interruptStats->maxBatch );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, "  %lld interrupt handler passes saved\n",
+                     interruptStats->serviced - interruptStats->batches );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: logLatencyStats
+Algorithm: reports the percentiles of each latency histogram that recorded
+            anything, one line per P op run, device service time, interrupt
+            delivery and scheduler decision
+Precondition: histograms gathered over the run
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: decision times are host time, so only the real time runner records
+       them, a virtual clock or replayed run's log is the same on every run
+*/
+void logLatencyStats( LatencyStats* latencyStats, DeviceTable* deviceTable,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char histogramName[STD_STR_LEN];
+   int index;
+   
+   reportLogger( "\n  Latency Histograms\n", configDataPtr, listHeadPtr );
+   
+   logHistogram( "P op run", &latencyStats->opRunUs, 1000.0, "ms",
+                                                configDataPtr, listHeadPtr );
+   
+   for( index = 0; index < DEVICE_COUNT; index++ )
+   {
+      sprintf( histogramName, "%s", deviceTable->devices[ index ].name );
+      logHistogram( histogramName, &deviceTable->devices[ index ].serviceHist,
+                                 1000.0, "ms", configDataPtr, listHeadPtr );
+   }
+   
+   logHistogram( "interrupt", &latencyStats->interruptUs, 1000.0, "ms",
+                                                configDataPtr, listHeadPtr );
+   logHistogram( "sched decide", &latencyStats->decisionNs, 1000.0, "us",
+                                                configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: logHistogram
+Algorithm: reports the count, mean, 50th, 90th, 99th and 99.9th percentiles
+            and the maximum of one histogram, in the units given
+Precondition: histogram gathered over the run, valuesPerUnit converts its
+               values to the units named by unitName
+Postcondition: report line sent to the reportLogger
+Exceptions: none
+Notes: an empty histogram is not reported
+*/
+void logHistogram( char* histogramName, LatencyHistogram* histogram,
+            double valuesPerUnit, char* unitName,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   
+   if( histogram->totalCount == 0 )
+   {
+      return;
+   }
+   
+   sprintf( reportLine, 
+      "  %-12s %s: n %lld, mean %.3f, p50 %.3f, p90 %.3f, p99 %.3f, "
+                                                "p99.9 %.3f, max %.3f\n",
+            histogramName, unitName, histogram->totalCount,
+            histogramMean( histogram ) / valuesPerUnit,
+            histogramPercentile( histogram, 50.0 ) / valuesPerUnit,
+            histogramPercentile( histogram, 90.0 ) / valuesPerUnit,
+            histogramPercentile( histogram, 99.0 ) / valuesPerUnit,
+            histogramPercentile( histogram, 99.9 ) / valuesPerUnit,
+            histogram->maxValue / valuesPerUnit );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: logCoreStats
+Algorithm: reports, for each CPU core, how busy it was, how many ops it
+            dispatched and how many processes it stole from other cores
+Precondition: core totals gathered over the run, and the run length
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: a single core is the whole CPU, so nothing is reported for it
+*/
+void logCoreStats( CoreStats* coreStats, int coreCount, long long elapsedUs,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   int index;
+   
+   if( coreCount <= 1 )
+   {
+      return;
+   }
+   
+   //guard against a zero length run
+   if( elapsedUs <= 0 )
+   {
+      elapsedUs = 1;
+   }
+   
+   reportLogger( "\n  Core Statistics\n", configDataPtr, listHeadPtr );
+   
+   for( index = 0; index < coreCount; index++ )
+   {
+      sprintf( reportLine, 
+               "  core %d: %.1f%% busy, %lld dispatches, %lld steals\n",
+               index, 100.0 * coreStats[ index ].busyUs / elapsedUs,
+               coreStats[ index ].dispatches, coreStats[ index ].steals );
+      reportLogger( reportLine, configDataPtr, listHeadPtr );
+   }
+}
+
+/*
+Function name: logDeadlineStats
+Algorithm: reports how many processes with a deadline met it, and how late
+            the ones that missed it ended
+Precondition: deadline totals gathered over the run
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: lateness is only reported when a deadline was missed
+*/
+void logDeadlineStats( DeadlineStats* deadlineStats,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   int missed = deadlineStats->missed;
+   
+   //nothing to report without a deadline
+   if( deadlineStats->deadlines == 0 )
+   {
+      return;
+   }
+   
+   reportLogger( "\n  Deadline Statistics\n", configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, "  %d of %d deadlines met, %d missed\n",
+            deadlineStats->deadlines - missed, deadlineStats->deadlines,
+                                                                     missed );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   if( missed == 0 )
+   {
+      return;
+   }
+   
+   sprintf( reportLine, 
+            "  lateness of a miss avg %.3f ms, max %.3f ms\n",
+            deadlineStats->totalLatenessUs / 1000.0 / missed,
+                                       deadlineStats->maxLatenessUs / 1000.0 );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: logSchedulingStats
+Algorithm: reports the average and longest wait from READY to dispatch over
+            every core, and Jain's fairness index over each process's share
+            of its runnable time spent on a CPU, scaled by its weight
+Precondition: process and core totals gathered over the run
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: a fairness of 1 means every process got the same weighted share,
+       1 / processCount means one process got all of it
+*/
+void logSchedulingStats( PCB* pcbArray, int processCount,
+                           CoreStats* coreStats, int coreCount,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   long long dispatches = 0;
+   long long readyWaitUs = 0;
+   long long maxReadyWaitUs = 0;
+   double shareSum = 0.0;
+   double shareSquareSum = 0.0;
+   double share;
+   double cpuUs;
+   int sharedCount = 0;
+   int index;
+   
+   for( index = 0; index < coreCount; index++ )
+   {
+      dispatches += coreStats[ index ].dispatches;
+      readyWaitUs += coreStats[ index ].readyWaitUs;
+      if( coreStats[ index ].maxReadyWaitUs > maxReadyWaitUs )
+      {
+         maxReadyWaitUs = coreStats[ index ].maxReadyWaitUs;
+      }
+   }
+   
+   for( index = 0; index < processCount; index++ )
+   {
+      cpuUs = pcbArray[ index ].cpuMs * 1000.0;
+      if( cpuUs + pcbArray[ index ].readyWaitUs > 0 )
+      {
+         share = cpuUs / ( cpuUs + pcbArray[ index ].readyWaitUs )
+                                                   / pcbArray[ index ].weight;
+         shareSum += share;
+         shareSquareSum += share * share;
+         sharedCount++;
+      }
+   }
+   
+   //guard against a run with no dispatches
+   if( dispatches == 0 )
+   {
+      dispatches = 1;
+   }
+   
+   reportLogger( "\n  Scheduling Statistics\n", configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, 
+            "  %lld dispatches, avg ready wait %.3f ms, max %.3f ms\n",
+            dispatches, readyWaitUs / 1000.0 / dispatches,
+                                                   maxReadyWaitUs / 1000.0 );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   if( sharedCount > 0 && shareSquareSum > 0.0 )
+   {
+      sprintf( reportLine, "  fairness (Jain) %.4f over %d processes\n",
+               shareSum * shareSum / ( sharedCount * shareSquareSum ),
+                                                               sharedCount );
+      reportLogger( reportLine, configDataPtr, listHeadPtr );
+   }
+}
+
+/*
+Function name: summariseRun
+Algorithm: totals processes completed, throughput, CPU utilisation and
+            context switches over the run, then the spread of each process's
+            turnaround, ready wait and response times
+Precondition: every process in EXIT, core totals gathered over the run,
+               originUs is the start of the run on the clock the PCBs were
+               stamped on
+Postcondition: runSummary filled in
+Exceptions: none
+Notes: turnaround runs from arrival to completion, response from arrival to
+       first dispatch
+*/
+void summariseRun( RunSummary* runSummary, PCB* pcbArray, int processCount,
+                  CoreStats* coreStats, int coreCount, long long originUs,
+                                                         long long elapsedUs )
+{
+   long long* turnaroundUs;
+   long long* waitingUs;
+   long long* responseUs;
+   long long busyUs = 0;
+   int completedCount = 0;
+   int index;
+   
+   runSummary->contextSwitches = 0;
+   for( index = 0; index < coreCount; index++ )
+   {
+      busyUs += coreStats[ index ].busyUs;
+      runSummary->contextSwitches += coreStats[ index ].contextSwitches;
+   }
+   
+   turnaroundUs = (long long*) malloc( sizeof( long long ) * processCount );
+   waitingUs = (long long*) malloc( sizeof( long long ) * processCount );
+   responseUs = (long long*) malloc( sizeof( long long ) * processCount );
+   
+   for( index = 0; index < processCount; index++ )
+   {
+      if( pcbArray[ index ].completionUs >= 0 )
+      {
+         turnaroundUs[ completedCount ] = pcbArray[ index ].completionUs 
+                                 - originUs - pcbArray[ index ].arrivalUs;
+         waitingUs[ completedCount ] = pcbArray[ index ].readyWaitUs;
+         responseUs[ completedCount ] = pcbArray[ index ].firstDispatchUs 
+                                 - originUs - pcbArray[ index ].arrivalUs;
+         completedCount++;
+      }
+   }
+   
+   //guard against a run that took no time
+   if( elapsedUs == 0 )
+   {
+      elapsedUs = 1;
+   }
+   
+   runSummary->processCount = processCount;
+   runSummary->completedCount = completedCount;
+   runSummary->coreCount = coreCount;
+   runSummary->elapsedUs = elapsedUs;
+   runSummary->throughput = completedCount * 1000000.0 / elapsedUs;
+   runSummary->cpuUtilisation = 100.0 * busyUs / elapsedUs / coreCount;
+   
+   summariseMetric( &runSummary->turnaround, turnaroundUs, completedCount );
+   summariseMetric( &runSummary->waiting, waitingUs, completedCount );
+   summariseMetric( &runSummary->response, responseUs, completedCount );
+   
+   free( turnaroundUs );
+   free( waitingUs );
+   free( responseUs );
+}
+
+/*
+Function name: summariseMetric
+Algorithm: sorts one time per process, and takes the mean and the nearest
+            rank 50th, 95th and 99th percentiles
+Precondition: count times in micro-seconds
+Postcondition: metric filled in, all zero when count is zero
+Exceptions: none
+Notes: sorts the times in place
+*/
+void summariseMetric( MetricSummary* metric, long long* valuesUs, int count )
+{
+   long long totalUs = 0;
+   int index;
+   
+   metric->meanMs = 0.0;
+   metric->p50Ms = 0.0;
+   metric->p95Ms = 0.0;
+   metric->p99Ms = 0.0;
+   
+   //nothing to summarise without a completed process
+   if( count == 0 )
+   {
+      return;
+   }
+   
+   qsort( valuesUs, count, sizeof( long long ), compareTimes );
+   
+   for( index = 0; index < count; index++ )
+   {
+      totalUs += valuesUs[ index ];
+   }
+   
+   metric->meanMs = totalUs / 1000.0 / count;
+   metric->p50Ms = valuesUs[ ( 50 * count + 99 ) / 100 - 1 ] / 1000.0;
+   metric->p95Ms = valuesUs[ ( 95 * count + 99 ) / 100 - 1 ] / 1000.0;
+   metric->p99Ms = valuesUs[ ( 99 * count + 99 ) / 100 - 1 ] / 1000.0;
+}
+
+/*
+Function name: logPerformanceSummary
+Algorithm: reports processes completed, throughput, CPU utilisation and
+            context switches over the run, then the spread of each process's
+            turnaround, ready wait and response times
+Precondition: runSummary filled in by summariseRun
+Postcondition: summary lines sent to the summaryLogger
+Exceptions: none
+Notes: none
+*/
+void logPerformanceSummary( RunSummary* runSummary,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   
+   summaryLogger( "\n  Performance Summary\n", configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, 
+            "  %d processes completed in %.3f s, throughput %.3f per sec\n",
+            runSummary->completedCount, runSummary->elapsedUs / 1000000.0,
+                                                   runSummary->throughput );
+   summaryLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, 
+            "  CPU utilisation %.1f%% over %d cores, %lld context switches\n",
+            runSummary->cpuUtilisation, runSummary->coreCount,
+                                                runSummary->contextSwitches );
+   summaryLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   //nothing to summarise without a completed process
+   if( runSummary->completedCount == 0 )
+   {
+      return;
+   }
+   
+   logMetricSummary( "turnaround", &runSummary->turnaround,
+                                                configDataPtr, listHeadPtr );
+   logMetricSummary( "waiting", &runSummary->waiting,
+                                                configDataPtr, listHeadPtr );
+   logMetricSummary( "response", &runSummary->response,
+                                                configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: logMetricSummary
+Algorithm: reports the mean and percentiles of one time over the processes
+Precondition: metric filled in by summariseMetric
+Postcondition: summary line sent to the summaryLogger
+Exceptions: none
+Notes: none
+*/
+void logMetricSummary( char* metricName, MetricSummary* metric,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   
+   sprintf( reportLine, 
+      "  %-10s ms: mean %.3f, p50 %.3f, p95 %.3f, p99 %.3f\n",
+            metricName, metric->meanMs, metric->p50Ms, metric->p95Ms,
+                                                            metric->p99Ms );
+   summaryLogger( reportLine, configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: summaryLogger
+Algorithm: sends one line of the performance summary to the reportLogger,
+            and to the monitor when the reportLogger would only log it to
+            the file
+Precondition: summary line and config data
+Postcondition: line printed, and stored for logToFile if logging to a file
+Exceptions: none
+Notes: the summary is always shown, so a run logged to file still ends with
+       its numbers on screen
+*/
+void summaryLogger( char* reportLine, ConfigDataType* configDataPtr,
+                                                LogLinkedList* listHeadPtr )
+{
+   char monitorString[STD_STR_LEN];
+   
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   configCodeToString( configDataPtr->logToCode, monitorString );
+   if( compareString( monitorString, "File" ) == STR_EQ )
+   {
+      printf( "%s", reportLine );
+   }
+}
+
+/*
+Function name: compareTimes
+Algorithm: qsort comparison for times in micro-seconds
+Precondition: two pointers to long long values
+Postcondition: returns less than, equal to or greater than zero
+Exceptions: none
+Notes: none
+*/
+int compareTimes( const void* first, const void* second )
+{
+   long long firstTime = *(const long long*) first;
+   long long secondTime = *(const long long*) second;
+   
+   return ( firstTime > secondTime ) - ( firstTime < secondTime );
+}
+
+/*
+Function name: writeSummaryFile
+Algorithm: writes one CSV row per process, with its arrival, first
+            dispatch and completion times, its ready wait, blocked and CPU
+            totals, and its turnaround and response times, all in ms
+Precondition: every process in EXIT, originUs is the start of the run on
+               the clock the PCBs were stamped on
+Postcondition: summary file written next to the log file
+Exceptions: none
+Notes: a process that never ran or ended has -1 for the missing times
+*/
+void writeSummaryFile( PCB* pcbArray, int processCount, long long originUs )
+{
+   FILE* filePtr = fopen( SUMMARY_FILE_NAME, "w" );
+   PCB* process;
+   double firstDispatchMs;
+   double completionMs;
+   int index;
+   
+   if( filePtr == NULL )
+   {
+      return;
+   }
+   
+   fprintf( filePtr, "pid,arrival_ms,first_dispatch_ms,completion_ms,"
+                     "ready_wait_ms,blocked_ms,cpu_ms,turnaround_ms,"
+                                                         "response_ms\n" );
+   
+   for( index = 0; index < processCount; index++ )
+   {
+      process = &pcbArray[ index ];
+      firstDispatchMs = -1.0;
+      completionMs = -1.0;
+      
+      if( process->firstDispatchUs >= 0 )
+      {
+         firstDispatchMs = ( process->firstDispatchUs - originUs ) / 1000.0;
+      }
+      
+      if( process->completionUs >= 0 )
+      {
+         completionMs = ( process->completionUs - originUs ) / 1000.0;
+      }
+      
+      fprintf( filePtr, "%d,%.3f,%.3f,%.3f,%.3f,%.3f,%lld,%.3f,%.3f\n",
+               process->pId, process->arrivalUs / 1000.0, firstDispatchMs,
+               completionMs, process->readyWaitUs / 1000.0,
+               process->blockedUs / 1000.0, process->cpuMs,
+               completionMs < 0 ? -1.0
+                        : completionMs - process->arrivalUs / 1000.0,
+               firstDispatchMs < 0 ? -1.0
+                        : firstDispatchMs - process->arrivalUs / 1000.0 );
+   }
+   
+   fclose( filePtr );
+}
+
+/*
+Function name: logOverheadStats
+Algorithm: reports the context switches over every core, the time spent on
+            switches and scheduler decisions, and the time spent warming a
+            cache, each as a share of the cores' busy time
+Precondition: core totals gathered over the run
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: only reported when a dispatch cost is configured
+*/
+void logOverheadStats( CoreStats* coreStats, int coreCount,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+   long long contextSwitches = 0;
+   long long switchOverheadUs = 0;
+   long long warmupUs = 0;
+   long long busyUs = 0;
+   int index;
+   
+   //nothing to report when dispatches are free
+   if( configDataPtr->switchCostCycles == 0 
+         && configDataPtr->decisionCostCycles == 0
+            && configDataPtr->warmupCostCycles == 0 )
+   {
+      return;
+   }
+   
+   for( index = 0; index < coreCount; index++ )
+   {
+      contextSwitches += coreStats[ index ].contextSwitches;
+      switchOverheadUs += coreStats[ index ].switchOverheadUs;
+      warmupUs += coreStats[ index ].warmupUs;
+      busyUs += coreStats[ index ].busyUs;
+   }
+   
+   //guard against a run with no busy time
+   if( busyUs == 0 )
+   {
+      busyUs = 1;
+   }
+   
+   reportLogger( "\n  Overhead Statistics\n", configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, 
+            "  %lld context switches, %.3f ms switching (%.1f%% of busy)\n",
+            contextSwitches, switchOverheadUs / 1000.0,
+                                          100.0 * switchOverheadUs / busyUs );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+   
+   sprintf( reportLine, "  %.3f ms cache warmup (%.1f%% of busy)\n",
+                        warmupUs / 1000.0, 100.0 * warmupUs / busyUs );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: printProfileStats
+Algorithm: prints each profiled section's calls, cycles and cycles per
+            call, and its share of the whole run, then splits the run into
+            simulated waiting, idle spinning and simulator work
+Precondition: run finished and the log file written, profile counters
+               gathered
+Postcondition: report printed to the monitor
+Exceptions: none
+Notes: only printed when built with SIM_PROFILE, and printed last so the log
+       file write is in it. Sections nest, and waits on several cores
+       overlap, so shares need not add up to 100%
+*/
+void printProfileStats( void )
+{
+   double runCycles = (double) profileCycles( PROF_RUN );
+   double workCycles;
+   long long calls;
+   int section;
+   
+   //nothing to report unless profiling was compiled in
+   if( profileCalls( PROF_RUN ) == 0 || runCycles == 0.0 )
+   {
+      return;
+   }
+   
+   printf( "\n  Simulator Profile\n" );
+   
+   for( section = 0; section < PROF_SECTION_COUNT; section++ )
+   {
+      calls = profileCalls( section );
+      if( calls > 0 )
+      {
+         printf( "  %-17s %9lld calls %15llu cycles %11.0f/call %6.1f%%\n",
+                  profileSectionName( section ), calls,
+                  profileCycles( section ),
+                  (double) profileCycles( section ) / calls,
+                  100.0 * profileCycles( section ) / runCycles );
+      }
+   }
+   
+   workCycles = runCycles - profileCycles( PROF_SIM_WAIT ) 
+                                          - profileCycles( PROF_IDLE );
+   if( workCycles < 0.0 )
+   {
+      workCycles = 0.0;
+   }
+   
+   printf( "  simulator work %.1f%%, simulated wait %.1f%%, idle %.1f%%\n",
+            100.0 * workCycles / runCycles,
+            100.0 * profileCycles( PROF_SIM_WAIT ) / runCycles,
+            100.0 * profileCycles( PROF_IDLE ) / runCycles );
+}
+
+/*
+Function name: createLogNode
+Algorithm: allocates a node just large enough for its line, and copies the
+            line in
+Precondition: C-style string of at most MAX_STR_LEN characters
+Postcondition: returns the new node, with next and tail set to NULL
+Exceptions: none
+Notes: none
+*/
+LogLinkedList* createLogNode( char* logLine )
+{
+   int lineLength = getStringLength( logLine );
+   LogLinkedList* newNodePtr = ( LogLinkedList * ) malloc( 
+                                 sizeof( LogLinkedList ) + lineLength + 1 );
+   
+   newNodePtr->logLine[0] = NULL_CHAR;
+   copyString( newNodePtr->logLine, logLine );
+   newNodePtr->next = NULL;
+   newNodePtr->tail = NULL;
+   
+   return newNodePtr;
 }
 
 /*
@@ -342,13 +1177,9 @@ LogLinkedList* addNodeLL( LogLinkedList* localPtr, LogLinkedList* newNode )
    // check for local pointer assigned to null
    if( localPtr == NULL )
    {
-      // access memory for new link/node
-      localPtr = ( LogLinkedList* ) malloc( sizeof( LogLinkedList ) );
-
-      // assign string value to the logLine
-      // assign next pointer to null
-      copyString( localPtr->logLine, newNode->logLine );
-      localPtr->next = NULL;
+      // access memory for new link/node, sized to the string value
+      // next and tail pointers start as null
+      localPtr = createLogNode( newNode->logLine );
 
       // return current local pointer
       return localPtr;
@@ -362,30 +1193,56 @@ LogLinkedList* addNodeLL( LogLinkedList* localPtr, LogLinkedList* newNode )
    return localPtr;
 }
 
+/*
+Function name: appendNodeLL
+Algorithm: links an already allocated node after the last node of the list,
+            using the tail cached on the head node to avoid walking the list
+Precondition: ptr to head of list, a new node with next set to NULL
+Postcondition: new node is the last node in list, and owned by the list
+Exceptions: none
+Notes: a head without a cached tail (built by addNodeLL) is walked once
+*/
+void appendNodeLL( LogLinkedList* listHeadPtr, LogLinkedList* newNode )
+{
+   LogLinkedList* lastNodePtr = listHeadPtr->tail;
+   PROFILE_BEGIN( PROF_LOG_LIST );
+   
+   //no cached tail yet, find the end of the list once
+   if( lastNodePtr == NULL )
+   {
+      lastNodePtr = listHeadPtr;
+      while( lastNodePtr->next != NULL )
+      {
+         lastNodePtr = lastNodePtr->next;
+      }
+   }
+   
+   lastNodePtr->next = newNode;
+   listHeadPtr->tail = newNode;
+   
+   PROFILE_END( PROF_LOG_LIST );
+}
+
 /*
 Function name: clearLinkedList
 Algorithm: responsible freeing all memory allocated by log linked list
 Precondition: ptr to the head of list
 Postcondition: returns null after all memory has been freed
 Exceptions: none
-Notes: none
+Notes: iterative, so very long logs do not exhaust the stack
 */
 LogLinkedList* clearLinkedList( LogLinkedList* localPtr )
 {
-   // check for local pointer not set to null (list not empty)
-   if( localPtr != NULL )
+   LogLinkedList* nextNodePtr = NULL;
+   
+   // loop until we run off the end of the list
+   while( localPtr != NULL )
    {
-      // check for local pointer's next node not null
-      if( localPtr->next != NULL )
-      {
-         // call recursive function with next pointer
-         clearLinkedList( localPtr->next );
-      }
-
-      // after recursive call, release memory to OS
+      // hold on to the next node, then release this one to the OS
+      nextNodePtr = localPtr->next;
       free( localPtr );
+      localPtr = nextNodePtr;
    }
    
    return NULL; 
 }
-
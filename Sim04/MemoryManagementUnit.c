@@ -9,6 +9,8 @@
  */
  
 #include "MemoryManagementUnit.h" 
+#include "Profiler.h"
+#include "Metrics.h"
 
 /*
 Function name: mmuAllocate
@@ -27,11 +29,13 @@ int mmuAllocate(ConfigDataType* configDataPtr, MMU* mmuCurrentPtr,
    MMU* newNodePtr = NULL;
    MMU* oldNodePtr = NULL;
    int memToUse = (mmuData.memBase * 1024) + mmuData.memOffset;
+   PROFILE_BEGIN( PROF_MMU_ALLOCATE );
    
    //check if this alloc will stay under config file limit
    if( configDataPtr->memAvailable < memToUse )
    {
       //return a segfault to calling function
+      PROFILE_END( PROF_MMU_ALLOCATE );
       return 1;
    }      
   
@@ -43,6 +47,7 @@ int mmuAllocate(ConfigDataType* configDataPtr, MMU* mmuCurrentPtr,
       if( oldNodePtr->memBase == mmuData.memBase )
       {
          //return seg fault to calling function
+         PROFILE_END( PROF_MMU_ALLOCATE );
          return 1;
       }
       
@@ -70,7 +75,9 @@ int mmuAllocate(ConfigDataType* configDataPtr, MMU* mmuCurrentPtr,
    }
    
    free( newNodePtr );
+   metricsAdd( configDataPtr, METRIC_MMU_ENTRIES, 1 );
    
+   PROFILE_END( PROF_MMU_ALLOCATE );
    return 0;
 }
 
@@ -89,6 +96,7 @@ int mmuAccess(ConfigDataType* configDataPtr, MMU* mmuCurrentPtr,
 {
    //initializations
    MMU* oldNodePtr = NULL;  
+   PROFILE_BEGIN( PROF_MMU_ACCESS );
   
    //check through list for our memory to access
    oldNodePtr = mmuHeadPtr;
@@ -100,6 +108,7 @@ int mmuAccess(ConfigDataType* configDataPtr, MMU* mmuCurrentPtr,
             && oldNodePtr->memOffset >= mmuData.memOffset )
       {
          //we found our memory to access and it was safe, proceed
+         PROFILE_END( PROF_MMU_ACCESS );
          return 0;
       }
       
@@ -107,6 +116,7 @@ int mmuAccess(ConfigDataType* configDataPtr, MMU* mmuCurrentPtr,
    }
    
    //if we get here we didnt have proper access so return a segfault
+   PROFILE_END( PROF_MMU_ACCESS );
    return 1;
 }
 
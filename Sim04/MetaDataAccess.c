@@ -15,18 +15,15 @@
 
 /*
 Function name: getOpCodes
-Algorithm: opens file, acquires op code data,
-           returns pointer to head of linked list
+Algorithm: opens file, reads its op code data through readOpCodes,
+           closes file
 Precondtion: for correct operation, file is available, is formated correrctly,
              and has all correctly formed op codes
 Postcondition: in correct operation,
                returns pointer to head of op code linked list
 Exceptions: correctly and appropriately (without program failure)
             responds to and reports file access failure,
-            incorrectly formatted lead or end descriptors,
-            incorrectly formatted prompt, incorrect op code letter,
-            icorrect op code name, op code value out of range,
-            and incomplete file conditions
+            and every error readOpCodes reports
 Notes: none
 */
 
@@ -35,17 +32,8 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
    // initialize read only constant
    const char READ_ONLY_FLAG[] = "r";
 
-   // initialize start and end counts for balanced app operations
-   int startCount = 0, endCount = 0;
-
-   // initialize local head pointer to null
-   OpCodeType *localHeadPtr = NULL;
-
-   // initialize variables
-   int accessResult;
-   char dataBuffer[ MAX_STR_LEN ];
-   OpCodeType *newNodePtr;
    FILE *fileAccessPtr;
+   int accessResult;
 
    // initialize op code data pointer in case of return error
    *opCodeDataHead = NULL;
@@ -59,14 +47,55 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
       return MD_FILE_ACCESS_ERR;
    }
 
+   accessResult = readOpCodes( fileAccessPtr, opCodeDataHead );
+
+   // close file
+   fclose( fileAccessPtr );
+
+   return accessResult;
+}
+
+/*
+Function name: readOpCodes
+Algorithm: acquires op code data from an open stream,
+           returns pointer to head of linked list
+Precondtion: for correct operation, stream is open at its start,
+             is formated correctly,
+             and has all correctly formed op codes
+Postcondition: in correct operation,
+               returns pointer to head of op code linked list
+Exceptions: correctly and appropriately (without program failure)
+            responds to and reports incorrectly formatted lead
+            or end descriptors,
+            incorrectly formatted prompt, incorrect op code letter,
+            icorrect op code name, op code value out of range,
+            and incomplete file conditions
+Notes: the stream is left open for the caller to close; a memory stream
+       reads the same as a file
+*/
+
+int readOpCodes( FILE *fileAccessPtr, OpCodeType **opCodeDataHead )
+{
+   // initialize start and end counts for balanced app operations
+   int startCount = 0, endCount = 0;
+
+   // initialize local head and tail pointers to null
+   OpCodeType *localHeadPtr = NULL;
+   OpCodeType *localTailPtr = NULL;
+
+   // initialize variables
+   int accessResult;
+   char dataBuffer[ MAX_STR_LEN ];
+   OpCodeType *newNodePtr;
+
+   // initialize op code data pointer in case of return error
+   *opCodeDataHead = NULL;
+
    // check first line for correct leader
    if( getLineTo( fileAccessPtr, MAX_STR_LEN, COLON,
                              dataBuffer, IGNORE_LEADING_WS ) != NO_ERR
       || compareString( dataBuffer, "Start Program Meta-Data Code" ) != STR_EQ )
    {
-      // close file
-      fclose( fileAccessPtr );
-      
       return MD_CORRUPT_DESCRIPTOR_ERR;
    }
 
@@ -83,9 +112,6 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
    // check for failure of first complete op command
    if( accessResult != COMPLETE_OPCMD_FOUND_MSG )
    {
-      // close file
-      fclose( fileAccessPtr );
-
       // clear data from the structure list
       *opCodeDataHead = clearMetaDataList( localHeadPtr );
 
@@ -100,8 +126,12 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
    // (while complete op commands are found)
    while( accessResult == COMPLETE_OPCMD_FOUND_MSG )
    {
-      // add the new op command to the linked list
-      localHeadPtr = addNode( localHeadPtr, newNodePtr );
+      // add the new op command to the linked list, after its tail
+      localTailPtr = addNodeAfter( localTailPtr, newNodePtr );
+      if( localHeadPtr == NULL )
+      {
+         localHeadPtr = localTailPtr;
+      }
 
       // get a new op command
       accessResult = getOpCommand( fileAccessPtr, newNodePtr );
@@ -118,7 +148,11 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
       if( startCount == endCount )
       {
          // add the last node to the linked list
-         localHeadPtr = addNode( localHeadPtr, newNodePtr );
+         localTailPtr = addNodeAfter( localTailPtr, newNodePtr );
+         if( localHeadPtr == NULL )
+         {
+            localHeadPtr = localTailPtr;
+         }
 
          // set access result to no error for later operation
          accessResult = NO_ERR;
@@ -148,9 +182,6 @@ int getOpCodes( char *fileName, OpCodeType **opCodeDataHead )
       localHeadPtr = clearMetaDataList( localHeadPtr );
    }
 
-   // close access file
-   fclose( fileAccessPtr );
-
    // release temporary structure memory
    free( newNodePtr );
 
@@ -388,6 +419,28 @@ OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode )
    return localPtr;
 }
 
+/*
+Function name: addNodeAfter
+Algorithm: adds op command structure with data after the tail of a linked
+           list, using addNode on the one node list that starts at the tail
+Precondition: tail pointer assigned to null or to the last op command link,
+              struct pointer assigned to op command structure data
+Postcondition: returns the new node, now the tail of the linked list
+Exceptions: none
+Notes: constant time, so loading large files is linear, where adding from
+       the head walks the whole list for every op
+*/
+OpCodeType *addNodeAfter( OpCodeType *tailPtr, OpCodeType *newNode )
+{
+   // an empty list, the new node is the whole list
+   if( tailPtr == NULL )
+   {
+      return addNode( NULL, newNode );
+   }
+
+   return addNode( tailPtr, newNode )->next;
+}
+
 /*
 Function name: checkOpString
 Algorithm: check tested op string against list of possibles
@@ -411,7 +464,10 @@ Boolean checkOpString( char *testStr )
      || compareString( testStr, "printer" )    == STR_EQ
      || compareString( testStr, "monitor" )    == STR_EQ
      || compareString( testStr, "run" )        == STR_EQ
-     || compareString( testStr, "start" )      == STR_EQ )
+     || compareString( testStr, "start" )      == STR_EQ
+     || compareString( testStr, "tickets" )    == STR_EQ
+     || compareString( testStr, "deadline" )   == STR_EQ
+     || compareString( testStr, "arrival" )    == STR_EQ )
    {
       return True;
    }
@@ -500,28 +556,25 @@ void displayMetaDataError( int code )
 
 /*
 Function name: clearMetaDataList
-Algorithm: recursively iterates through op code linked list,
-           returns memory to OS from the bottom of the list upward
+Algorithm: iterates through op code linked list,
+           returns memory to OS from the top of the list downward
 Precondition: linked list, with or without data
 Postcondition: all node memory, if any, is returned to OS,
                return pointer (head) is set to null
 Exceptions: none
-Notes: none
+Notes: iterative, so very long lists do not exhaust the stack
 */
 OpCodeType *clearMetaDataList( OpCodeType *localPtr )
 {
-    // check for local pointer not set to null (list not empty)
-    if( localPtr != NULL )
-   {
-        // check for local pointer's next node not null
-      if( localPtr->next != NULL )
-      {
-         // call recursive function with next pointer
-         clearMetaDataList( localPtr->next );
-      }
+   OpCodeType *nextNodePtr;
 
-      // after recursive call, release memory to OS
+   // loop until we run off the end of the list
+   while( localPtr != NULL )
+   {
+      // hold on to the next node, then release this one to the OS
+      nextNodePtr = localPtr->next;
       free( localPtr );
+      localPtr = nextNodePtr;
    }
    
    return NULL; 
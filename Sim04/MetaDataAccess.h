@@ -36,10 +36,12 @@ typedef struct OpCodeType
 
 // function prototypes
 int getOpCodes( char *fileName, OpCodeType **opCodeDataHead );
+int readOpCodes( FILE *fileAccessPtr, OpCodeType **opCodeDataHead );
 int getOpCommand( FILE *filePtr, OpCodeType *inData );
 int updateStartCount( int count, char *opString );
 int updateEndCount( int count, char *opString );
 OpCodeType *addNode( OpCodeType *localPtr, OpCodeType *newNode );
+OpCodeType *addNodeAfter( OpCodeType *tailPtr, OpCodeType *newNode );
 Boolean checkOpString( char *testStr );
 Boolean isDigit( char testChar );
 void displayMetaData( OpCodeType *localPtr );
@@ -0,0 +1,445 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Metrics.c
+ *
+ *
+ * @version 5.54
+ *          Kristopher Moore (19 October 2026)
+ *          Live run metrics, served on a UNIX domain socket.
+ */
+
+//UNIX domain sockets and poll are POSIX, not C99
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "Metrics.h"
+#include "simtimer.h"
+
+//how often the server looks for a stop, and how long it waits for a
+//client to say whether it wants an HTTP reply
+#define METRICS_POLL_MS 100
+#define METRICS_REQUEST_MS 50
+#define METRICS_TEXT_LEN 4096
+
+//the served values, and the config of the run they are counted for, NULL
+//unless a socket is being served, written by the run's threads with atomic
+//adds and stores, read by the server thread with atomic loads
+static long long metricValues[ METRIC_COUNT ];
+static ConfigDataType* metricsOwner = NULL;
+static int metricsStopping = 0;
+
+//the socket and its server thread, only touched by open and close, which
+//hold the lock so runs starting or ending at once take turns
+static pthread_mutex_t metricsLock = PTHREAD_MUTEX_INITIALIZER;
+static int listenFd = -1;
+static pthread_t serverThread;
+static char socketName[ 100 ];
+static Boolean metricsRealTime = False;
+static long long metricsStartUs = 0;
+
+//the scrape before this one, only touched by the server thread
+static long long lastScrapeUs = 0;
+static long long lastDecisions = 0;
+
+static const char* const stateNames[ METRIC_INTERRUPT_QUEUE ] =
+   { "new", "ready", "running", "blocked", "exit" };
+
+//static helpers
+static long long metricsRead( MetricId metric );
+static void* metricsServer( void* unused );
+static void metricsServe( int clientFd );
+static int metricsFormat( char* text, int textLength );
+static Boolean metricsSend( int clientFd, const char* text, int length );
+
+/*
+Function name: metricsOpen
+Algorithm: binds a UNIX domain socket at the path the config names, zeroes
+            the values and starts a thread that answers each connection
+            with a snapshot of them
+Precondition: config data loaded, called before the run's first event
+Postcondition: socket served if a path is named, otherwise nothing
+Exceptions: an unusable path is reported, and the run goes on unserved
+Notes: only one run in the process is served at a time. A socket left
+       behind by an earlier run at the path is replaced, anything else
+       there is left alone
+*/
+void metricsOpen( ConfigDataType* configDataPtr, Boolean realTime )
+{
+   struct sockaddr_un address;
+   struct stat pathStat;
+   int index;
+
+   if( configDataPtr->metricsSocketName[ 0 ] == NULL_CHAR )
+   {
+      return;
+   }
+
+   pthread_mutex_lock( &metricsLock );
+   if( listenFd >= 0 )
+   {
+      printf( "Metrics socket %s not opened, %s serves another run\n",
+                              configDataPtr->metricsSocketName, socketName );
+      pthread_mutex_unlock( &metricsLock );
+      return;
+   }
+
+   memset( &address, 0, sizeof( address ) );
+   address.sun_family = AF_UNIX;
+   if( strlen( configDataPtr->metricsSocketName )
+                                             >= sizeof( address.sun_path ) )
+   {
+      printf( "Unable to open metrics socket %s, run not served\n",
+                                          configDataPtr->metricsSocketName );
+      pthread_mutex_unlock( &metricsLock );
+      return;
+   }
+   strcpy( address.sun_path, configDataPtr->metricsSocketName );
+
+   if( lstat( address.sun_path, &pathStat ) == 0
+                                          && S_ISSOCK( pathStat.st_mode ) )
+   {
+      unlink( address.sun_path );
+   }
+
+   listenFd = socket( AF_UNIX, SOCK_STREAM, 0 );
+   if( listenFd < 0
+      || bind( listenFd, (struct sockaddr*) &address, sizeof( address ) ) != 0
+      || listen( listenFd, 8 ) != 0 )
+   {
+      printf( "Unable to open metrics socket %s, run not served\n",
+                                          configDataPtr->metricsSocketName );
+      if( listenFd >= 0 )
+      {
+         close( listenFd );
+         listenFd = -1;
+      }
+      pthread_mutex_unlock( &metricsLock );
+      return;
+   }
+
+   strcpy( socketName, address.sun_path );
+   for( index = 0; index < METRIC_COUNT; index++ )
+   {
+      metricValues[ index ] = 0;
+   }
+   metricsRealTime = realTime;
+   metricsStartUs = wallTimeUs();
+   lastScrapeUs = metricsStartUs;
+   lastDecisions = 0;
+   metricsStopping = 0;
+
+#ifdef __GNUC__
+   __atomic_store_n( &metricsOwner, configDataPtr, __ATOMIC_RELEASE );
+#else
+   metricsOwner = configDataPtr;
+#endif
+
+   if( pthread_create( &serverThread, NULL, metricsServer, NULL ) != 0 )
+   {
+      printf( "Unable to serve metrics socket %s, run not served\n",
+                                                               socketName );
+#ifdef __GNUC__
+      __atomic_store_n( &metricsOwner, NULL, __ATOMIC_RELEASE );
+#else
+      metricsOwner = NULL;
+#endif
+      close( listenFd );
+      listenFd = -1;
+      unlink( socketName );
+   }
+   pthread_mutex_unlock( &metricsLock );
+}
+
+/*
+Function name: metricsAdd
+Algorithm: adds delta to the value
+Precondition: configDataPtr of the run counting it, metric in range
+Postcondition: value updated, if the run's socket is being served
+Exceptions: none
+Notes: atomic, so threads need no lock of their own
+*/
+void metricsAdd( ConfigDataType* configDataPtr, MetricId metric,
+                                                            long long delta )
+{
+#ifdef __GNUC__
+   if( __atomic_load_n( &metricsOwner, __ATOMIC_RELAXED ) == configDataPtr )
+   {
+      __atomic_fetch_add( &metricValues[ metric ], delta, __ATOMIC_RELAXED );
+   }
+#else
+   if( metricsOwner == configDataPtr )
+   {
+      metricValues[ metric ] += delta;
+   }
+#endif
+}
+
+/*
+Function name: metricsSet
+Algorithm: replaces the value
+Precondition: configDataPtr of the run setting it, metric in range
+Postcondition: value updated, if the run's socket is being served
+Exceptions: none
+Notes: atomic, so threads need no lock of their own
+*/
+void metricsSet( ConfigDataType* configDataPtr, MetricId metric,
+                                                            long long value )
+{
+#ifdef __GNUC__
+   if( __atomic_load_n( &metricsOwner, __ATOMIC_RELAXED ) == configDataPtr )
+   {
+      __atomic_store_n( &metricValues[ metric ], value, __ATOMIC_RELAXED );
+   }
+#else
+   if( metricsOwner == configDataPtr )
+   {
+      metricValues[ metric ] = value;
+   }
+#endif
+}
+
+/*
+Function name: metricsClose
+Algorithm: stops the server thread, then closes and removes the socket
+Precondition: configDataPtr is the config of a run calling metricsOpen
+Postcondition: no socket served, the next run may open one
+Exceptions: none
+Notes: a scrape in progress is finished first. Only the run being served
+       closes the socket, so another run ending alongside leaves it be
+*/
+void metricsClose( ConfigDataType* configDataPtr )
+{
+   pthread_mutex_lock( &metricsLock );
+   if( listenFd < 0 || configDataPtr != metricsOwner )
+   {
+      pthread_mutex_unlock( &metricsLock );
+      return;
+   }
+
+#ifdef __GNUC__
+   __atomic_store_n( &metricsStopping, 1, __ATOMIC_RELEASE );
+#else
+   metricsStopping = 1;
+#endif
+   pthread_join( serverThread, NULL );
+
+#ifdef __GNUC__
+   __atomic_store_n( &metricsOwner, NULL, __ATOMIC_RELEASE );
+#else
+   metricsOwner = NULL;
+#endif
+   close( listenFd );
+   listenFd = -1;
+   unlink( socketName );
+   pthread_mutex_unlock( &metricsLock );
+}
+
+/*
+Function name: metricsRead
+Algorithm: reads a value as the run's threads last left it
+Precondition: metric in range
+Postcondition: returns the value
+Exceptions: none
+Notes: none
+*/
+static long long metricsRead( MetricId metric )
+{
+#ifdef __GNUC__
+   return __atomic_load_n( &metricValues[ metric ], __ATOMIC_RELAXED );
+#else
+   return metricValues[ metric ];
+#endif
+}
+
+/*
+Function name: metricsServer
+Algorithm: waits for connections on the socket, serving each in turn, and
+            looks for a stop between waits
+Precondition: socket listening
+Postcondition: returns NULL once metricsClose asks it to stop
+Exceptions: a failed accept is skipped
+Notes: runs on its own thread, and never touches the simulation's state
+*/
+static void* metricsServer( void* unused )
+{
+   struct pollfd listenPoll;
+   int clientFd;
+
+   listenPoll.fd = listenFd;
+   listenPoll.events = POLLIN;
+
+#ifdef __GNUC__
+   while( __atomic_load_n( &metricsStopping, __ATOMIC_ACQUIRE ) == 0 )
+#else
+   while( metricsStopping == 0 )
+#endif
+   {
+      if( poll( &listenPoll, 1, METRICS_POLL_MS ) > 0 )
+      {
+         clientFd = accept( listenFd, NULL, NULL );
+         if( clientFd >= 0 )
+         {
+            metricsServe( clientFd );
+            close( clientFd );
+         }
+      }
+   }
+
+   return NULL;
+}
+
+/*
+Function name: metricsServe
+Algorithm: gives the client a moment to send a request, then writes the
+            snapshot, behind an HTTP header if the request was a GET
+Precondition: clientFd connected
+Postcondition: snapshot written, as far as the client would take it
+Exceptions: a client that hangs up early is let go
+Notes: so both a scraper speaking HTTP over the socket, and a plain
+       connection such as socat's, get the text
+*/
+static void metricsServe( int clientFd )
+{
+   struct pollfd clientPoll;
+   char request[ STD_STR_LEN ];
+   char header[ STD_STR_LEN ];
+   char text[ METRICS_TEXT_LEN ];
+   int requestLength = 0;
+   int textLength;
+
+   clientPoll.fd = clientFd;
+   clientPoll.events = POLLIN;
+   if( poll( &clientPoll, 1, METRICS_REQUEST_MS ) > 0 )
+   {
+      requestLength = (int) read( clientFd, request, sizeof( request ) );
+   }
+
+   textLength = metricsFormat( text, METRICS_TEXT_LEN );
+
+   if( requestLength >= 4 && strncmp( request, "GET ", 4 ) == 0 )
+   {
+      sprintf( header, "HTTP/1.0 200 OK\r\n"
+                     "Content-Type: text/plain; version=0.0.4\r\n"
+                     "Content-Length: %d\r\n\r\n", textLength );
+      if( metricsSend( clientFd, header, (int) strlen( header ) ) == False )
+      {
+         return;
+      }
+   }
+
+   metricsSend( clientFd, text, textLength );
+}
+
+/*
+Function name: metricsFormat
+Algorithm: writes every value in the Prometheus text exposition format,
+            with the simulated and wall clock times in seconds, and the
+            scheduler decisions a wall clock second since the last scrape
+Precondition: text holds textLength characters
+Postcondition: returns the length written
+Exceptions: none
+Notes: a real time run's simulated time is its wall clock time
+*/
+static int metricsFormat( char* text, int textLength )
+{
+   long long nowUs = wallTimeUs();
+   long long wallUs = nowUs - metricsStartUs;
+   long long simUs = metricsRealTime == True
+                              ? wallUs : metricsRead( METRIC_SIM_TIME_US );
+   long long decisions = metricsRead( METRIC_SCHED_DECISIONS );
+   double decisionRate = 0.0;
+   int length = 0;
+   int index;
+
+   if( nowUs > lastScrapeUs )
+   {
+      decisionRate = (double) ( decisions - lastDecisions ) * 1000000.0
+                                       / (double) ( nowUs - lastScrapeUs );
+   }
+   lastScrapeUs = nowUs;
+   lastDecisions = decisions;
+
+   length += snprintf( text + length, textLength - length,
+            "# HELP sim04_processes Processes in each state.\n"
+            "# TYPE sim04_processes gauge\n" );
+   for( index = METRIC_PROCESSES_NEW; index <= METRIC_PROCESSES_EXIT; index++ )
+   {
+      length += snprintf( text + length, textLength - length,
+               "sim04_processes{state=\"%s\"} %lld\n",
+                                 stateNames[ index ], metricsRead( index ) );
+   }
+
+   length += snprintf( text + length, textLength - length,
+      "# HELP sim04_interrupt_queue_depth Interrupts raised, not yet "
+                                                            "serviced.\n"
+      "# TYPE sim04_interrupt_queue_depth gauge\n"
+      "sim04_interrupt_queue_depth %lld\n"
+      "# HELP sim04_io_in_flight I/O requests started, not yet complete, "
+                                 "one thread each on the real time clock.\n"
+      "# TYPE sim04_io_in_flight gauge\n"
+      "sim04_io_in_flight %lld\n"
+      "# HELP sim04_mmu_entries Segments allocated in the MMU table.\n"
+      "# TYPE sim04_mmu_entries gauge\n"
+      "sim04_mmu_entries %lld\n",
+            metricsRead( METRIC_INTERRUPT_QUEUE ),
+               metricsRead( METRIC_IO_IN_FLIGHT ),
+                  metricsRead( METRIC_MMU_ENTRIES ) );
+
+   length += snprintf( text + length, textLength - length,
+      "# HELP sim04_events_logged_total Events logged.\n"
+      "# TYPE sim04_events_logged_total counter\n"
+      "sim04_events_logged_total %lld\n"
+      "# HELP sim04_simulated_seconds Simulated time reached.\n"
+      "# TYPE sim04_simulated_seconds gauge\n"
+      "sim04_simulated_seconds %.6f\n"
+      "# HELP sim04_wall_seconds Wall clock time since the run began.\n"
+      "# TYPE sim04_wall_seconds gauge\n"
+      "sim04_wall_seconds %.6f\n",
+            metricsRead( METRIC_EVENTS_LOGGED ),
+               (double) simUs / 1000000.0, (double) wallUs / 1000000.0 );
+
+   length += snprintf( text + length, textLength - length,
+      "# HELP sim04_scheduler_decisions_total Scheduler decisions made.\n"
+      "# TYPE sim04_scheduler_decisions_total counter\n"
+      "sim04_scheduler_decisions_total %lld\n"
+      "# HELP sim04_scheduler_decisions_per_second Scheduler decisions a "
+                              "wall clock second, since the last scrape.\n"
+      "# TYPE sim04_scheduler_decisions_per_second gauge\n"
+      "sim04_scheduler_decisions_per_second %.1f\n",
+                                                decisions, decisionRate );
+
+   return length;
+}
+
+/*
+Function name: metricsSend
+Algorithm: writes all of length characters, however many writes it takes
+Precondition: clientFd connected
+Postcondition: returns True once all are written, False if the client
+               hung up
+Exceptions: none
+Notes: sent without SIGPIPE, so a client hanging up never ends the run
+*/
+static Boolean metricsSend( int clientFd, const char* text, int length )
+{
+   ssize_t written;
+
+   while( length > 0 )
+   {
+      written = send( clientFd, text, length, MSG_NOSIGNAL );
+      if( written <= 0 )
+      {
+         return False;
+      }
+      text += written;
+      length -= (int) written;
+   }
+
+   return True;
+}
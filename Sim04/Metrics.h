@@ -0,0 +1,45 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file Metrics.h
+ *
+ * @version 5.54
+ *          Kristopher Moore (19 October 2026)
+ *          Live run metrics, served on a UNIX domain socket.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "ConfigAccess.h"
+
+//values kept while a run is served, the process counts follow the order of
+//ProcessState, so the count of a state is METRIC_PROCESSES_NEW + state
+typedef enum
+{
+   METRIC_PROCESSES_NEW,
+   METRIC_PROCESSES_READY,
+   METRIC_PROCESSES_RUNNING,
+   METRIC_PROCESSES_BLOCKED,
+   METRIC_PROCESSES_EXIT,
+   METRIC_INTERRUPT_QUEUE,
+   METRIC_IO_IN_FLIGHT,
+   METRIC_MMU_ENTRIES,
+   METRIC_EVENTS_LOGGED,
+   METRIC_SCHED_DECISIONS,
+   METRIC_SIM_TIME_US,
+   METRIC_COUNT
+
+} MetricId;
+
+//NOTE: metricsAdd and metricsSet do nothing unless the socket is being served
+//      for the run whose config they are given, they never take a lock, so
+//      the cores and I/O threads call them from wherever a value changes
+//function prototypes
+void metricsOpen( ConfigDataType* configDataPtr, Boolean realTime );
+void metricsAdd( ConfigDataType* configDataPtr, MetricId metric,
+                                                            long long delta );
+void metricsSet( ConfigDataType* configDataPtr, MetricId metric,
+                                                            long long value );
+void metricsClose( ConfigDataType* configDataPtr );
+
+#endif // METRICS_H
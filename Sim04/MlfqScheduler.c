@@ -0,0 +1,378 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file MlfqScheduler.c
+ *
+ *
+ * @version 5.41
+ *          Kristopher Moore (19 October 2026)
+ *          Multi-level feedback queue scheduling policy, MLFQ-P.
+ */
+
+//needs simRunner for the PCB definition
+#include "SimRunner.h"
+
+//MLFQ state, one FIFO per level linked through next[], so enqueue and
+//pickNext are O(1) per level. A process's level is only valid while its
+//epoch matches the boost epoch, so a boost is O(levels), not O(n)
+typedef struct
+{
+   int levelCount;
+   int quantumMs;
+   int boostMs;
+   long long cpuSinceBoostMs;
+   int boostEpoch;
+   int* level;
+   int* epoch;
+   int* next;
+   int* head;
+   int* tail;
+
+} MlfqState;
+
+//static helpers
+static int mlfqLevel( MlfqState* mlfq, int pId );
+static void mlfqSetLevel( MlfqState* mlfq, int pId, int level );
+static void mlfqCharge( MlfqState* mlfq, int ranMs );
+static void mlfqBoost( MlfqState* mlfq );
+
+//policy callbacks, MLFQ-P
+static void* mlfqInit( int processCount, ConfigDataType* configDataPtr );
+static void mlfqEnqueue( void* state, struct PCB* process );
+static int mlfqPickNext( void* state );
+static void mlfqPreempt( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed );
+static void mlfqBlock( void* state, struct PCB* process, int ranMs );
+static void mlfqExit( void* state, struct PCB* process, int ranMs );
+static int mlfqTimeSlice( void* state, struct PCB* process );
+static void mlfqDestruct( void* state );
+static void mlfqSave( void* state, int processCount, FILE* filePtr );
+static Boolean mlfqRestore( void* state, int processCount, FILE* filePtr );
+
+const SchedulerPolicy mlfqPPolicy =
+   { "MLFQ-P", True, mlfqInit, mlfqEnqueue, mlfqPickNext,
+        mlfqPreempt, mlfqBlock, mlfqExit, mlfqTimeSlice, mlfqDestruct,
+                                                      mlfqSave, mlfqRestore };
+
+/*
+Function name: mlfqInit
+Algorithm: allocates the per pId level and link arrays, and one empty FIFO
+            per configured level
+Precondition: count of processes in the run
+Postcondition: returns the MLFQ state, every process starts at level 0
+Exceptions: none
+Notes: boost epoch starts at 1, so an unset epoch of 0 reads as level 0
+*/
+static void* mlfqInit( int processCount, ConfigDataType* configDataPtr )
+{
+   MlfqState* mlfq = (MlfqState*) malloc( sizeof( MlfqState ) );
+   int index;
+
+   mlfq->levelCount = configDataPtr->mlfqLevels;
+   mlfq->quantumMs =
+                     configDataPtr->quantumCycles * configDataPtr->procCycleRate;
+   mlfq->boostMs = configDataPtr->mlfqBoostMs;
+   mlfq->cpuSinceBoostMs = 0;
+   mlfq->boostEpoch = 1;
+
+   mlfq->level = (int*) calloc( processCount + 1, sizeof( int ) );
+   mlfq->epoch = (int*) calloc( processCount + 1, sizeof( int ) );
+   mlfq->next = (int*) calloc( processCount + 1, sizeof( int ) );
+   mlfq->head = (int*) malloc( mlfq->levelCount * sizeof( int ) );
+   mlfq->tail = (int*) malloc( mlfq->levelCount * sizeof( int ) );
+
+   for( index = 0; index < mlfq->levelCount; index++ )
+   {
+      mlfq->head[ index ] = -1;
+      mlfq->tail[ index ] = -1;
+   }
+
+   return mlfq;
+}
+
+/*
+Function name: mlfqEnqueue
+Algorithm: appends the process to the tail of its level's FIFO
+Precondition: process not already queued
+Postcondition: process queued
+Exceptions: none
+Notes: O(1)
+*/
+static void mlfqEnqueue( void* state, struct PCB* process )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+   int level = mlfqLevel( mlfq, process->pId );
+
+   mlfq->next[ process->pId ] = -1;
+
+   if( mlfq->tail[ level ] == -1 )
+   {
+      mlfq->head[ level ] = process->pId;
+   }
+
+   else
+   {
+      mlfq->next[ mlfq->tail[ level ] ] = process->pId;
+   }
+
+   mlfq->tail[ level ] = process->pId;
+}
+
+/*
+Function name: mlfqPickNext
+Algorithm: takes the head of the highest priority non-empty level
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(levels)
+*/
+static int mlfqPickNext( void* state )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+   int level = 0;
+   int pId;
+
+   while( mlfq->head[ level ] == -1 )
+   {
+      level++;
+   }
+
+   pId = mlfq->head[ level ];
+   mlfq->head[ level ] = mlfq->next[ pId ];
+
+   if( mlfq->head[ level ] == -1 )
+   {
+      mlfq->tail[ level ] = -1;
+   }
+
+   return pId;
+}
+
+/*
+Function name: mlfqPreempt
+Algorithm: demotes the process one level if it used its whole quantum,
+            then charges the time toward the next boost
+Precondition: process was RUNNING for ranMs
+Postcondition: level updated
+Exceptions: none
+Notes: a process that finished its op early keeps its level
+*/
+static void mlfqPreempt( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+   int level = mlfqLevel( mlfq, process->pId );
+
+   if( quantumUsed == True && level < mlfq->levelCount - 1 )
+   {
+      mlfqSetLevel( mlfq, process->pId, level + 1 );
+   }
+
+   mlfqCharge( mlfq, ranMs );
+}
+
+/*
+Function name: mlfqBlock
+Algorithm: promotes the process one level for giving up the CPU on I/O,
+            then charges the time toward the next boost
+Precondition: process was RUNNING for ranMs, now BLOCKED
+Postcondition: level updated
+Exceptions: none
+Notes: none
+*/
+static void mlfqBlock( void* state, struct PCB* process, int ranMs )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+   int level = mlfqLevel( mlfq, process->pId );
+
+   if( level > 0 )
+   {
+      mlfqSetLevel( mlfq, process->pId, level - 1 );
+   }
+
+   mlfqCharge( mlfq, ranMs );
+}
+
+/*
+Function name: mlfqExit
+Algorithm: charges the process's last run toward the next boost
+Precondition: process was RUNNING for ranMs, now EXIT
+Postcondition: boost clock updated
+Exceptions: none
+Notes: none
+*/
+static void mlfqExit( void* state, struct PCB* process, int ranMs )
+{
+   mlfqCharge( (MlfqState*) state, ranMs );
+}
+
+/*
+Function name: mlfqTimeSlice
+Algorithm: the quantum doubles with every level below the top
+Precondition: process about to run a P op
+Postcondition: returns the slice in ms, 0 if no quantum is configured
+Exceptions: none
+Notes: none
+*/
+static int mlfqTimeSlice( void* state, struct PCB* process )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+
+   return mlfq->quantumMs << mlfqLevel( mlfq, process->pId );
+}
+
+/*
+Function name: mlfqDestruct
+Algorithm: frees the level arrays and the state
+Precondition: state from mlfqInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void mlfqDestruct( void* state )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+
+   free( mlfq->level );
+   free( mlfq->epoch );
+   free( mlfq->next );
+   free( mlfq->head );
+   free( mlfq->tail );
+   free( mlfq );
+}
+
+/*
+Function name: mlfqSave
+Algorithm: writes the boost clock, the per pId arrays and the level FIFOs
+Precondition: state from mlfqInit
+Postcondition: state written
+Exceptions: none
+Notes: none
+*/
+static void mlfqSave( void* state, int processCount, FILE* filePtr )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+
+   fwrite( &mlfq->cpuSinceBoostMs, sizeof( long long ), 1, filePtr );
+   fwrite( &mlfq->boostEpoch, sizeof( int ), 1, filePtr );
+   fwrite( mlfq->level, sizeof( int ), processCount + 1, filePtr );
+   fwrite( mlfq->epoch, sizeof( int ), processCount + 1, filePtr );
+   fwrite( mlfq->next, sizeof( int ), processCount + 1, filePtr );
+   fwrite( mlfq->head, sizeof( int ), mlfq->levelCount, filePtr );
+   fwrite( mlfq->tail, sizeof( int ), mlfq->levelCount, filePtr );
+}
+
+/*
+Function name: mlfqRestore
+Algorithm: reads back what mlfqSave wrote
+Precondition: state fresh from mlfqInit, for the same process and level counts
+Postcondition: returns True with the state as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean mlfqRestore( void* state, int processCount, FILE* filePtr )
+{
+   MlfqState* mlfq = (MlfqState*) state;
+   size_t readCount = 0;
+
+   readCount += fread( &mlfq->cpuSinceBoostMs, sizeof( long long ), 1,
+                                                                  filePtr );
+   readCount += fread( &mlfq->boostEpoch, sizeof( int ), 1, filePtr );
+   readCount += fread( mlfq->level, sizeof( int ), processCount + 1, filePtr );
+   readCount += fread( mlfq->epoch, sizeof( int ), processCount + 1, filePtr );
+   readCount += fread( mlfq->next, sizeof( int ), processCount + 1, filePtr );
+   readCount += fread( mlfq->head, sizeof( int ), mlfq->levelCount, filePtr );
+   readCount += fread( mlfq->tail, sizeof( int ), mlfq->levelCount, filePtr );
+
+   return readCount == (size_t) ( ( processCount + 1 ) * 3
+                              + mlfq->levelCount * 2 + 2 ) ? True : False;
+}
+
+/*
+Function name: mlfqLevel
+Algorithm: reads a process's level, a stale epoch means it has been boosted
+Precondition: pId in range
+Postcondition: returns the current level
+Exceptions: none
+Notes: none
+*/
+static int mlfqLevel( MlfqState* mlfq, int pId )
+{
+   if( mlfq->epoch[ pId ] != mlfq->boostEpoch )
+   {
+      return 0;
+   }
+
+   return mlfq->level[ pId ];
+}
+
+/*
+Function name: mlfqSetLevel
+Algorithm: stores a process's level under the current boost epoch
+Precondition: process not queued, so its FIFO does not change
+Postcondition: level stored
+Exceptions: none
+Notes: none
+*/
+static void mlfqSetLevel( MlfqState* mlfq, int pId, int level )
+{
+   mlfq->level[ pId ] = level;
+   mlfq->epoch[ pId ] = mlfq->boostEpoch;
+}
+
+/*
+Function name: mlfqCharge
+Algorithm: adds CPU time run on this core, boosting once it reaches the
+            configured interval
+Precondition: ranMs of CPU time just used
+Postcondition: boost clock updated, may have boosted
+Exceptions: none
+Notes: the policy has no clock of its own, so the interval is measured in
+       CPU time handed out, which is the same in both clock modes
+*/
+static void mlfqCharge( MlfqState* mlfq, int ranMs )
+{
+   mlfq->cpuSinceBoostMs += ranMs;
+
+   if( mlfq->boostMs > 0 && mlfq->cpuSinceBoostMs >= mlfq->boostMs )
+   {
+      mlfqBoost( mlfq );
+      mlfq->cpuSinceBoostMs = 0;
+   }
+}
+
+/*
+Function name: mlfqBoost
+Algorithm: moves every process to level 0, queued ones by splicing each
+            lower FIFO onto the tail of the top one in level order, the rest
+            by advancing the epoch
+Precondition: initialized state
+Postcondition: every process at level 0
+Exceptions: none
+Notes: O(levels)
+*/
+static void mlfqBoost( MlfqState* mlfq )
+{
+   int level;
+
+   for( level = 1; level < mlfq->levelCount; level++ )
+   {
+      if( mlfq->head[ level ] != -1 )
+      {
+         if( mlfq->tail[ 0 ] == -1 )
+         {
+            mlfq->head[ 0 ] = mlfq->head[ level ];
+         }
+
+         else
+         {
+            mlfq->next[ mlfq->tail[ 0 ] ] = mlfq->head[ level ];
+         }
+
+         mlfq->tail[ 0 ] = mlfq->tail[ level ];
+         mlfq->head[ level ] = -1;
+         mlfq->tail[ level ] = -1;
+      }
+   }
+
+   mlfq->boostEpoch++;
+}
@@ -0,0 +1,99 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Profiler.c
+ *
+ *
+ * @version 5.46
+ *          Kristopher Moore (19 October 2026)
+ *          Scoped cycle counters over the simulator's own subsystems.
+ */
+
+#include "Profiler.h"
+#include "simtimer.h"
+
+//totals for each section, shared by every core and I/O thread
+static long long sectionCalls[ PROF_SECTION_COUNT ];
+static unsigned long long sectionCycles[ PROF_SECTION_COUNT ];
+
+static const char* const sectionNames[ PROF_SECTION_COUNT ] =
+   { "whole run", "simulated wait", "idle spin", "scheduler", "interrupts",
+     "event calendar", "event data", "event logger", "log list",
+     "log file", "mmu allocate", "mmu access", "end of run report" };
+
+/*
+Function name: profileNow
+Algorithm: reads the processor's cycle counter, or a nano-second clock
+            where there is none
+Precondition: none
+Postcondition: returns the current count
+Exceptions: none
+Notes: only differences between two reads on the same machine mean anything
+*/
+unsigned long long profileNow( void )
+{
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+   return __builtin_ia32_rdtsc();
+#else
+   return (unsigned long long) wallTimeNs();
+#endif
+}
+
+/*
+Function name: profileAdd
+Algorithm: counts a call of the section, and the cycles since it began
+Precondition: startCycles read by profileNow as the section began
+Postcondition: section totals updated
+Exceptions: none
+Notes: atomic, so threads need no lock of their own
+*/
+void profileAdd( ProfileSection section, unsigned long long startCycles )
+{
+   unsigned long long cycles = profileNow() - startCycles;
+
+#ifdef __GNUC__
+   __atomic_fetch_add( &sectionCalls[ section ], 1, __ATOMIC_RELAXED );
+   __atomic_fetch_add( &sectionCycles[ section ], cycles, __ATOMIC_RELAXED );
+#else
+   sectionCalls[ section ]++;
+   sectionCycles[ section ] += cycles;
+#endif
+}
+
+/*
+Function name: profileCalls
+Algorithm: reads a section's call count
+Precondition: section in range
+Postcondition: returns the count, 0 when profiling is compiled out
+Exceptions: none
+Notes: none
+*/
+long long profileCalls( ProfileSection section )
+{
+   return sectionCalls[ section ];
+}
+
+/*
+Function name: profileCycles
+Algorithm: reads a section's cycle total
+Precondition: section in range
+Postcondition: returns the total
+Exceptions: none
+Notes: none
+*/
+unsigned long long profileCycles( ProfileSection section )
+{
+   return sectionCycles[ section ];
+}
+
+/*
+Function name: profileSectionName
+Algorithm: looks up a section's report name
+Precondition: section in range
+Postcondition: returns the name
+Exceptions: none
+Notes: none
+*/
+const char* profileSectionName( ProfileSection section )
+{
+   return sectionNames[ section ];
+}
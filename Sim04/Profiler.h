@@ -0,0 +1,56 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file Profiler.h
+ *
+ * @version 5.46
+ *          Kristopher Moore (19 October 2026)
+ *          Scoped cycle counters over the simulator's own subsystems.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "StringUtils.h"
+
+//profiled sections, a section may run inside another, so shares of the run
+//can add up past 100%
+typedef enum
+{
+   PROF_RUN,
+   PROF_SIM_WAIT,
+   PROF_IDLE,
+   PROF_SCHEDULER,
+   PROF_INTERRUPTS,
+   PROF_CALENDAR,
+   PROF_EVENT_DATA,
+   PROF_EVENT_LOGGER,
+   PROF_LOG_LIST,
+   PROF_LOG_FILE,
+   PROF_MMU_ALLOCATE,
+   PROF_MMU_ACCESS,
+   PROF_REPORT,
+   PROF_SECTION_COUNT
+
+} ProfileSection;
+
+//NOTE: the counters are compiled out unless built with -DSIM_PROFILE, see
+//      PROFILE in Sim04_mf. PROFILE_BEGIN declares the section's start, so
+//      it must open a block or follow a declaration, and be matched by one
+//      PROFILE_END in the same block
+#ifdef SIM_PROFILE
+#define PROFILE_BEGIN( section ) \
+                  unsigned long long profileStart##section = profileNow()
+#define PROFILE_END( section ) profileAdd( section, profileStart##section )
+#else
+#define PROFILE_BEGIN( section ) ( (void) 0 )
+#define PROFILE_END( section ) ( (void) 0 )
+#endif
+
+//function prototypes
+unsigned long long profileNow( void );
+void profileAdd( ProfileSection section, unsigned long long startCycles );
+long long profileCalls( ProfileSection section );
+unsigned long long profileCycles( ProfileSection section );
+const char* profileSectionName( ProfileSection section );
+
+#endif // PROFILER_H
@@ -0,0 +1,645 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Replay.c
+ *
+ *
+ * @version 5.53
+ *          Kristopher Moore (19 October 2026)
+ *          Record and replay of the interrupt queue's order.
+ */
+
+#include <string.h>
+
+//needs simRunner for the queue, recorder and EventSimulation definitions
+#include "SimRunner.h"
+
+//first bytes of every recording, the last digit is the format version
+#define RECORD_MAGIC "SIM04IR1"
+#define RECORD_MAGIC_LEN 8
+
+//a record is two varints, its gap in us from the record before, then
+//pId << RECORD_KIND_BITS | kind
+#define RECORD_KIND_BITS 2
+#define RECORD_KIND_MASK 3
+
+//no recorded gap comes near this, it is only a guard against garbage
+#define RECORD_MAX_GAP_US ( 1LL << 50 )
+
+//static prototypes
+static void writeVarint( FILE* filePtr, unsigned long long value );
+static Boolean readVarint( FILE* filePtr, unsigned long long* valuePtr );
+static int findHeld( EventSimulation* sim, int pId );
+static Boolean replayBatchDue( EventSimulation* sim, ReplayTrigger trigger,
+                                    int batchSize, long long heldAgeUs );
+static void serviceHeld( EventSimulation* sim, int pId, RecordKind kind );
+
+/*
+Function name: recordOpen
+Algorithm: opens the config's interrupt record file and writes its header,
+            the process count, so a replay can check it has the same
+            meta data, and whether its times are from a real clock
+Precondition: recorder not open, originUs the time, on the clock the run
+              will record with, of its start, realTime set when dequeue
+              times are not decided by the run's own events
+Postcondition: recorder open when the config names a record file,
+               otherwise every record is ignored
+Exceptions: none
+Notes: a file that can not be opened is reported, and the run goes on
+       without a recording
+*/
+void recordOpen( InterruptRecorder* recorder, ConfigDataType* configDataPtr,
+               int processCount, long long originUs, Boolean realTime )
+{
+   recorder->filePtr = NULL;
+   recorder->fileName = configDataPtr->recordFileName;
+   recorder->originUs = originUs;
+   recorder->lastUs = 0;
+
+   if( recorder->fileName[ 0 ] == NULL_CHAR )
+   {
+      return;
+   }
+
+   recorder->filePtr = fopen( recorder->fileName, "wb" );
+   if( recorder->filePtr == NULL )
+   {
+      printf( "Interrupt record file %s could not be opened\n",
+                                                         recorder->fileName );
+      return;
+   }
+
+   fwrite( RECORD_MAGIC, 1, RECORD_MAGIC_LEN, recorder->filePtr );
+   writeVarint( recorder->filePtr, (unsigned long long) processCount );
+   writeVarint( recorder->filePtr, realTime == True ? 1 : 0 );
+}
+
+/*
+Function name: recordInterrupt
+Algorithm: appends one enqueue or dequeue of the interrupt queue, as its
+            gap from the last record and the process it was for
+Precondition: recorder from recordOpen, or NULL
+Postcondition: record written when the recorder is open
+Exceptions: none
+Notes: callers keep records in queue order, the real time runner records
+       under the queue lock. A clock that steps back is held at the last
+       record, so gaps are never negative
+*/
+void recordInterrupt( InterruptRecorder* recorder, RecordKind kind, int pId,
+                                                            long long nowUs )
+{
+   long long timeUs;
+
+   if( recorder == NULL || recorder->filePtr == NULL )
+   {
+      return;
+   }
+
+   timeUs = nowUs - recorder->originUs;
+   if( timeUs < recorder->lastUs )
+   {
+      timeUs = recorder->lastUs;
+   }
+
+   writeVarint( recorder->filePtr,
+                        (unsigned long long) ( timeUs - recorder->lastUs ) );
+   writeVarint( recorder->filePtr,
+      ( (unsigned long long) pId << RECORD_KIND_BITS ) | (unsigned) kind );
+   recorder->lastUs = timeUs;
+}
+
+/*
+Function name: recordClose
+Algorithm: closes the record file, if one is open
+Precondition: recorder from recordOpen
+Postcondition: recording complete on disk
+Exceptions: none
+Notes: a write that failed anywhere in the run is reported here
+*/
+void recordClose( InterruptRecorder* recorder )
+{
+   if( recorder->filePtr == NULL )
+   {
+      return;
+   }
+
+   if( ferror( recorder->filePtr ) != 0 || fclose( recorder->filePtr ) != 0 )
+   {
+      printf( "Interrupt record file %s could not be written\n",
+                                                         recorder->fileName );
+   }
+   recorder->filePtr = NULL;
+}
+
+/*
+Function name: replayLoad
+Algorithm: reads a whole recording, then sorts it into each process's
+            enqueue times, in order, and the list of every dequeue
+Precondition: processCount of the run about to replay it
+Postcondition: returns the replay, ready to follow from its start
+Exceptions: returns NULL, with a message, when the file can not be opened,
+            is cut short, or was recorded over other meta data
+Notes: release with replayDestruct
+*/
+InterruptReplay* replayLoad( char* fileName, int processCount )
+{
+   InterruptReplay* replay;
+   InterruptRecord* records = NULL;
+   char magic[ RECORD_MAGIC_LEN ];
+   unsigned long long gapUs = 0;
+   unsigned long long value = 0;
+   long long timeUs = 0;
+   int recordCount = 0;
+   int capacity = 0;
+   int enqueueCount = 0;
+   int index, pId, nextByte;
+   Boolean intact, realTime;
+   FILE* filePtr;
+
+   filePtr = fopen( fileName, "rb" );
+   if( filePtr == NULL )
+   {
+      printf( "Interrupt record file %s could not be opened\n", fileName );
+      return NULL;
+   }
+
+   intact = fread( magic, 1, RECORD_MAGIC_LEN, filePtr ) == RECORD_MAGIC_LEN
+            && memcmp( magic, RECORD_MAGIC, RECORD_MAGIC_LEN ) == 0
+            && readVarint( filePtr, &value ) == True
+            && value == (unsigned long long) processCount
+            && readVarint( filePtr, &value ) == True && value <= 1;
+   realTime = value == 1 ? True : False;
+
+   //records until the end of the file, which may only fall between them
+   while( intact == True && ( nextByte = fgetc( filePtr ) ) != EOF )
+   {
+      ungetc( nextByte, filePtr );
+      intact = readVarint( filePtr, &gapUs ) && readVarint( filePtr, &value )
+            && gapUs < RECORD_MAX_GAP_US
+            && ( value & RECORD_KIND_MASK ) <= RECORD_BATCH
+            && ( value >> RECORD_KIND_BITS ) < (unsigned) processCount;
+
+      if( intact == True )
+      {
+         if( recordCount == capacity )
+         {
+            capacity = capacity == 0 ? 1024 : capacity * 2;
+            records = (InterruptRecord*) realloc( records,
+                                    sizeof( InterruptRecord ) * capacity );
+         }
+
+         timeUs += (long long) gapUs;
+         records[ recordCount ].timeUs = timeUs;
+         records[ recordCount ].pId = (int) ( value >> RECORD_KIND_BITS );
+         records[ recordCount ].kind =
+                              (RecordKind) ( value & RECORD_KIND_MASK );
+         recordCount++;
+      }
+   }
+   fclose( filePtr );
+
+   if( intact == False )
+   {
+      printf( "Interrupt record file %s is corrupt, or not a recording of"
+                                          " this meta data\n", fileName );
+      free( records );
+      return NULL;
+   }
+
+   replay = (InterruptReplay*) malloc( sizeof( InterruptReplay ) );
+   replay->ioFirst = (int*) calloc( processCount + 1, sizeof( int ) );
+   replay->ioNext = (int*) malloc( sizeof( int ) * ( processCount + 1 ) );
+   replay->dequeues = (InterruptRecord*) malloc( sizeof( InterruptRecord )
+                                                      * ( recordCount + 1 ) );
+   replay->dequeueCount = 0;
+   replay->nextDequeue = 0;
+   replay->realTime = realTime;
+   replay->flushUs = -1;
+   replay->followed = 0;
+   replay->diverged = 0;
+
+   //count each process's enqueues, then lay them out process by process
+   for( index = 0; index < recordCount; index++ )
+   {
+      if( records[ index ].kind == RECORD_ENQUEUE )
+      {
+         replay->ioFirst[ records[ index ].pId + 1 ]++;
+         enqueueCount++;
+      }
+      else
+      {
+         replay->dequeues[ replay->dequeueCount++ ] = records[ index ];
+      }
+   }
+   for( pId = 0; pId < processCount; pId++ )
+   {
+      replay->ioFirst[ pId + 1 ] += replay->ioFirst[ pId ];
+      replay->ioNext[ pId ] = replay->ioFirst[ pId ];
+   }
+
+   replay->ioDoneUs = (long long*) malloc( sizeof( long long )
+                                                   * ( enqueueCount + 1 ) );
+   for( index = 0; index < recordCount; index++ )
+   {
+      if( records[ index ].kind == RECORD_ENQUEUE )
+      {
+         pId = records[ index ].pId;
+         replay->ioDoneUs[ replay->ioNext[ pId ]++ ] = records[ index ].timeUs;
+      }
+   }
+   for( pId = 0; pId < processCount; pId++ )
+   {
+      replay->ioNext[ pId ] = replay->ioFirst[ pId ];
+   }
+
+   free( records );
+   return replay;
+}
+
+/*
+Function name: replayIoDone
+Algorithm: when replaying, gives the recorded completion of the process's
+            next I/O, otherwise the time the run worked out itself
+Precondition: pId's I/O has just been given a device channel
+Postcondition: returns the time to place its interrupt on the calendar
+Exceptions: none
+Notes: a completion recorded before now is brought up to now, and an I/O
+       past the end of the process's recording keeps its own time
+*/
+long long replayIoDone( EventSimulation* sim, int pId, long long defaultUs )
+{
+   InterruptReplay* replay = sim->replay;
+   long long doneUs;
+
+   if( replay == NULL || replay->ioNext[ pId ] == replay->ioFirst[ pId + 1 ] )
+   {
+      return defaultUs;
+   }
+
+   doneUs = replay->ioDoneUs[ replay->ioNext[ pId ]++ ];
+   return doneUs > sim->clockUs ? doneUs : sim->clockUs;
+}
+
+/*
+Function name: replayInterrupt
+Algorithm: holds the raised interrupt, starting the coalescing window as
+            raiseInterrupt would when it is the first held, then services
+            whatever the recording now allows
+Precondition: replaying, pId has just finished its I/O and is still BLOCKED
+Postcondition: process READY, or BLOCKED until the recording reaches it
+Exceptions: none
+Notes: the held interrupts use the coalescing batch's arrays, batches are
+       made up as the recording made them
+*/
+void replayInterrupt( EventSimulation* sim, int pId )
+{
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+
+   if( sim->pendingCount == 0 && configDataPtr->intCoalesceWindowMs > 0 )
+   {
+      eventQueuePush( &sim->eventQueue,
+               sim->clockUs + configDataPtr->intCoalesceWindowMs * 1000LL,
+                                                   EV_INTERRUPT_FLUSH, -1 );
+   }
+
+   sim->pendingInterrupts[ sim->pendingCount ] = pId;
+   sim->pendingRaisedUs[ sim->pendingCount ] = sim->clockUs;
+   sim->pendingCount++;
+   metricsSet( sim->configDataPtr, METRIC_INTERRUPT_QUEUE, sim->pendingCount );
+
+   replayService( sim, REPLAY_RAISE );
+}
+
+/*
+Function name: replayService
+Algorithm: services recorded dequeues in order, a single interrupt or a
+            whole batch at a time, once every interrupt of it has been
+            raised and the clock has reached its recorded time. When a real
+            time recording's time is still to come, a flush event is placed
+            on the calendar for it, and it is serviced when that comes due.
+            Otherwise a coalescing config services a batch where the
+            virtual runner would, at a raise that fills it, at a window
+            flush, or at an idle CPU. Without coalescing a batch is serviced
+            as soon as it is ready
+Precondition: replaying, trigger is where the simulation has got to
+Postcondition: held interrupts serviced as far as the recording allows,
+               returns True when any were
+Exceptions: none
+Notes: servicing where the recording's own run did keeps the rest of the
+       run in step with it, so a virtual clock recording replays exactly.
+       REPLAY_STUCK is for an empty calendar, so nothing more will be
+       raised, a time still to come gets its own flush. The dequeues this
+       run can not follow are then skipped, and once the recording runs out
+       the interrupts still held are serviced in the order raised, and
+       counted as diverged
+*/
+Boolean replayService( EventSimulation* sim, ReplayTrigger trigger )
+{
+   InterruptReplay* replay = sim->replay;
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+   InterruptRecord* record;
+   char timeString[MAX_STR_LEN];
+   EventData eventData;
+   long long heldSinceUs;
+   int batchSize, index, heldIndex;
+   Boolean serviced = False;
+
+   while( replay->nextDequeue < replay->dequeueCount )
+   {
+      record = &replay->dequeues[ replay->nextDequeue ];
+      batchSize = 1;
+      if( record->kind == RECORD_BATCH )
+      {
+         while( replay->nextDequeue + batchSize < replay->dequeueCount
+                        && record[ batchSize ].kind == RECORD_DEQUEUE )
+         {
+            batchSize++;
+         }
+      }
+
+      //every interrupt of the batch must have been raised
+      heldSinceUs = sim->clockUs;
+      for( index = 0; index < batchSize; index++ )
+      {
+         heldIndex = findHeld( sim, record[ index ].pId );
+         if( heldIndex < 0 )
+         {
+            break;
+         }
+
+         if( sim->pendingRaisedUs[ heldIndex ] < heldSinceUs )
+         {
+            heldSinceUs = sim->pendingRaisedUs[ heldIndex ];
+         }
+      }
+      if( index < batchSize )
+      {
+         if( trigger != REPLAY_STUCK )
+         {
+            return serviced;
+         }
+
+         replay->nextDequeue++;
+         continue;
+      }
+
+      //and the clock must have reached it
+      if( sim->clockUs < record->timeUs )
+      {
+         if( ( replay->realTime == True || trigger == REPLAY_STUCK )
+                                    && replay->flushUs != record->timeUs )
+         {
+            eventQueuePush( &sim->eventQueue, record->timeUs,
+                                                   EV_INTERRUPT_FLUSH, -1 );
+            replay->flushUs = record->timeUs;
+         }
+         return serviced;
+      }
+
+      //and a coalescing run would service a batch here
+      if( interruptCoalescing( configDataPtr ) == True
+            && replayBatchDue( sim, trigger, batchSize,
+                                    sim->clockUs - heldSinceUs ) == False )
+      {
+         return serviced;
+      }
+
+      //EVENT LOG: Interrupt batch of batchSize, for a coalesced recording
+      if( record->kind == RECORD_BATCH )
+      {
+         virtualTimeToString( sim->clockUs, timeString );
+         eventData = generateEventData( OS, InterruptBatch, timeString,
+                                                                  NULL, NULL );
+         eventData.batchSize = batchSize;
+         eventLogger( eventData, sim->configDataPtr, sim->listHeadPtr );
+      }
+      for( index = 0; index < batchSize; index++ )
+      {
+         serviceHeld( sim, record[ index ].pId,
+                           index == 0 ? record->kind : RECORD_DEQUEUE );
+      }
+
+      sim->interruptStats.serviced += batchSize;
+      sim->interruptStats.batches++;
+      if( batchSize > sim->interruptStats.maxBatch )
+      {
+         sim->interruptStats.maxBatch = batchSize;
+      }
+      replay->followed += batchSize;
+      replay->nextDequeue += batchSize;
+      serviced = True;
+   }
+
+   //past the end of the recording, nothing else will release them
+   while( trigger == REPLAY_STUCK && sim->pendingCount > 0 )
+   {
+      serviceHeld( sim, sim->pendingInterrupts[ 0 ], RECORD_DEQUEUE );
+      sim->interruptStats.serviced++;
+      sim->interruptStats.batches++;
+      if( sim->interruptStats.maxBatch < 1 )
+      {
+         sim->interruptStats.maxBatch = 1;
+      }
+      replay->diverged++;
+      serviced = True;
+   }
+
+   return serviced;
+}
+
+/*
+Function name: logReplayStats
+Algorithm: reports how many interrupts were serviced as recorded, and how
+            many could not be
+Precondition: replay followed to the end of the run, or NULL
+Postcondition: report lines sent to the reportLogger
+Exceptions: none
+Notes: nothing is reported when the run was not a replay
+*/
+void logReplayStats( InterruptReplay* replay, ConfigDataType* configDataPtr,
+                                                LogLinkedList* listHeadPtr )
+{
+   char reportLine[MAX_STR_LEN];
+
+   if( replay == NULL )
+   {
+      return;
+   }
+
+   reportLogger( "\n  Replay Statistics\n", configDataPtr, listHeadPtr );
+
+   sprintf( reportLine, "  %lld interrupts in recorded order, %lld diverged,"
+               " %d recorded dequeues unused\n", replay->followed,
+                  replay->diverged,
+                        replay->dequeueCount - replay->nextDequeue );
+   reportLogger( reportLine, configDataPtr, listHeadPtr );
+}
+
+/*
+Function name: replayDestruct
+Algorithm: frees a replay
+Precondition: replay from replayLoad, or NULL
+Postcondition: memory released, returns NULL
+Exceptions: none
+Notes: none
+*/
+InterruptReplay* replayDestruct( InterruptReplay* replay )
+{
+   if( replay != NULL )
+   {
+      free( replay->dequeues );
+      free( replay->ioDoneUs );
+      free( replay->ioFirst );
+      free( replay->ioNext );
+      free( replay );
+   }
+
+   return NULL;
+}
+
+/*
+Function name: writeVarint
+Algorithm: writes the value seven bits at a time, lowest first, with the
+            top bit of each byte set while more follow
+Precondition: filePtr open for writing
+Postcondition: one to ten bytes written
+Exceptions: none
+Notes: most gaps and pIds take one or two bytes
+*/
+static void writeVarint( FILE* filePtr, unsigned long long value )
+{
+   while( value >= 0x80 )
+   {
+      fputc( (int) ( ( value & 0x7f ) | 0x80 ), filePtr );
+      value >>= 7;
+   }
+
+   fputc( (int) value, filePtr );
+}
+
+/*
+Function name: readVarint
+Algorithm: reads back a value written by writeVarint
+Precondition: filePtr open for reading
+Postcondition: returns True with the value read
+Exceptions: returns False when the file ends inside the value, or the value
+            runs past 64 bits
+Notes: none
+*/
+static Boolean readVarint( FILE* filePtr, unsigned long long* valuePtr )
+{
+   unsigned long long value = 0;
+   int shift = 0;
+   int nextByte;
+
+   do
+   {
+      nextByte = fgetc( filePtr );
+      if( nextByte == EOF || shift > 63 )
+      {
+         return False;
+      }
+
+      value |= (unsigned long long) ( nextByte & 0x7f ) << shift;
+      shift += 7;
+   }
+   while( ( nextByte & 0x80 ) != 0 );
+
+   *valuePtr = value;
+   return True;
+}
+
+/*
+Function name: findHeld
+Algorithm: linear search of the held interrupts for the process
+Precondition: replaying
+Postcondition: returns its index, or -1 when it is not held
+Exceptions: none
+Notes: only a few interrupts are ever held at once
+*/
+static int findHeld( EventSimulation* sim, int pId )
+{
+   int index;
+
+   for( index = 0; index < sim->pendingCount; index++ )
+   {
+      if( sim->pendingInterrupts[ index ] == pId )
+      {
+         return index;
+      }
+   }
+
+   return -1;
+}
+
+/*
+Function name: replayBatchDue
+Algorithm: decides as the virtual runner would whether a ready batch is
+            serviced here, a raise only services a batch that reaches the
+            coalesce count, a window flush or an idle CPU one that
+            interruptBatchDue finds due, and the replay's own flush or an
+            empty calendar always do
+Precondition: coalescing config, every interrupt of the batch held and its
+              recorded time reached
+Postcondition: returns True when the batch is serviced now
+Exceptions: none
+Notes: a flush at the time the replay set its own for is taken as its own
+*/
+static Boolean replayBatchDue( EventSimulation* sim, ReplayTrigger trigger,
+                                    int batchSize, long long heldAgeUs )
+{
+   ConfigDataType* configDataPtr = sim->configDataPtr;
+
+   switch( trigger )
+   {
+      case REPLAY_RAISE:
+         return ( configDataPtr->intCoalesceCount > 1
+                  && batchSize >= configDataPtr->intCoalesceCount );
+
+      case REPLAY_IDLE:
+         return interruptBatchDue( configDataPtr, batchSize, heldAgeUs, True );
+
+      case REPLAY_FLUSH:
+         if( sim->clockUs == sim->replay->flushUs )
+         {
+            return True;
+         }
+         return interruptBatchDue( configDataPtr, batchSize, heldAgeUs, False );
+
+      case REPLAY_STUCK:
+         break;
+   }
+
+   return True;
+}
+
+/*
+Function name: serviceHeld
+Algorithm: services one held interrupt as raiseInterrupt would, and takes
+            it out of the held list, keeping the rest in the order raised
+Precondition: pId is held
+Postcondition: process READY, its dequeue recorded when the run records
+Exceptions: none
+Notes: the caller keeps the interrupt totals, as a batch counts once
+*/
+static void serviceHeld( EventSimulation* sim, int pId, RecordKind kind )
+{
+   int heldIndex = findHeld( sim, pId );
+
+   histogramRecord( &sim->latencyStats.interruptUs,
+                           sim->clockUs - sim->pendingRaisedUs[ heldIndex ] );
+   recordInterrupt( &sim->recorder, kind, pId, sim->clockUs );
+   makeReady( sim->configDataPtr, sim->schedulers, &sim->pcbArray[ pId ],
+                                                               sim->clockUs );
+
+   //EVENT LOG: Interrupt Called by Process
+   logSimEvent( sim, OS, Interrupt, pId );
+
+   sim->pendingCount--;
+   metricsSet( sim->configDataPtr, METRIC_INTERRUPT_QUEUE, sim->pendingCount );
+   memmove( &sim->pendingInterrupts[ heldIndex ],
+                  &sim->pendingInterrupts[ heldIndex + 1 ],
+                        sizeof( int ) * ( sim->pendingCount - heldIndex ) );
+   memmove( &sim->pendingRaisedUs[ heldIndex ],
+                  &sim->pendingRaisedUs[ heldIndex + 1 ],
+                  sizeof( long long ) * ( sim->pendingCount - heldIndex ) );
+}
@@ -0,0 +1,808 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Scheduler.c
+ *
+ *
+ * @version 5.40
+ *          Kristopher Moore (19 October 2026)
+ *          Pluggable CPU scheduling policies, registered by name.
+ */
+
+//needs simRunner for the PCB definition
+#include "SimRunner.h"
+
+//ready set shared by the FCFS and RR policies, a Fenwick tree over arrival
+//positions holding 1 for every queued process, so the first queued arrival,
+//or the next one after a position, is found in O(log n)
+typedef struct
+{
+   int* tree;
+   int* pIdAt;
+   int size;
+   int count;
+   int highBit;
+   int lastPosition;
+   int quantumMs;
+
+} ReadySet;
+
+//shortest remaining time policies keep a heap keyed by remaining time
+typedef struct
+{
+   ProcessHeap heap;
+
+} ShortestJobState;
+
+//static helpers for the ready set
+static void readySetAdd( ReadySet* readySet, int position, int delta );
+static int readySetPrefix( ReadySet* readySet, int position );
+static int readySetFind( ReadySet* readySet, int rank );
+
+//policy callbacks, FCFS-N and FCFS-P
+static void* fcfsInit( int processCount, ConfigDataType* configDataPtr );
+static void fcfsEnqueue( void* state, struct PCB* process );
+static int fcfsPickNext( void* state );
+static void fcfsDestruct( void* state );
+static void fcfsSave( void* state, int processCount, FILE* filePtr );
+static Boolean fcfsRestore( void* state, int processCount, FILE* filePtr );
+
+//policy callbacks, RR-P
+static int roundRobinPickNext( void* state );
+static int roundRobinTimeSlice( void* state, struct PCB* process );
+
+//policy callbacks, SJF-N and SRTF-P
+static void* shortestJobInit( int processCount, ConfigDataType* configDataPtr );
+static void shortestJobEnqueue( void* state, struct PCB* process );
+static int shortestJobPickNext( void* state );
+static void shortestJobDestruct( void* state );
+static void shortestJobSave( void* state, int processCount, FILE* filePtr );
+static Boolean shortestJobRestore( void* state, int processCount,
+                                                            FILE* filePtr );
+
+//the original five policies
+static const SchedulerPolicy sjfNPolicy =
+   { "SJF-N", False, shortestJobInit, shortestJobEnqueue,
+        shortestJobPickNext, NULL, NULL, NULL, NULL, shortestJobDestruct,
+                                       shortestJobSave, shortestJobRestore };
+
+static const SchedulerPolicy srtfPPolicy =
+   { "SRTF-P", True, shortestJobInit, shortestJobEnqueue,
+        shortestJobPickNext, NULL, NULL, NULL, NULL, shortestJobDestruct,
+                                       shortestJobSave, shortestJobRestore };
+
+static const SchedulerPolicy fcfsPPolicy =
+   { "FCFS-P", True, fcfsInit, fcfsEnqueue,
+        fcfsPickNext, NULL, NULL, NULL, NULL, fcfsDestruct,
+                                                      fcfsSave, fcfsRestore };
+
+static const SchedulerPolicy rrPPolicy =
+   { "RR-P", True, fcfsInit, fcfsEnqueue,
+        roundRobinPickNext, NULL, NULL, NULL, roundRobinTimeSlice,
+                                       fcfsDestruct, fcfsSave, fcfsRestore };
+
+static const SchedulerPolicy fcfsNPolicy =
+   { "FCFS-N", False, fcfsInit, fcfsEnqueue,
+        fcfsPickNext, NULL, NULL, NULL, NULL, fcfsDestruct,
+                                                      fcfsSave, fcfsRestore };
+
+//REGISTRY, indexed by cpuSchedCode, so the first five entries must stay in
+//the order of the CPU_SCHED codes in CpuSchedCodes, new policies are
+//appended after them
+static const SchedulerPolicy* const schedulerRegistry[] =
+{
+   &sjfNPolicy,
+   &srtfPPolicy,
+   &fcfsPPolicy,
+   &rrPPolicy,
+   &fcfsNPolicy,
+   &mlfqPPolicy,
+   &cfsPPolicy,
+   &lotteryPPolicy,
+   &stridePPolicy,
+   &edfPPolicy
+};
+
+static const int schedulerCount =
+                  sizeof( schedulerRegistry ) / sizeof( SchedulerPolicy* );
+
+/*
+Function name: getSchedulerPolicy
+Algorithm: looks up a policy in the registry by its code
+Precondition: code from findSchedulerCode
+Postcondition: returns the policy, FCFS-N for an unknown code
+Exceptions: none
+Notes: none
+*/
+const SchedulerPolicy* getSchedulerPolicy( int schedCode )
+{
+   if( schedCode < 0 || schedCode >= schedulerCount )
+   {
+      return schedulerRegistry[ CPU_SCHED_FCFS_N_CODE ];
+   }
+
+   return schedulerRegistry[ schedCode ];
+}
+
+/*
+Function name: findSchedulerCode
+Algorithm: case insensitive search of the registry for a policy name
+Precondition: C-style string from the config file
+Postcondition: returns the code of the policy, or -1 if none is registered
+Exceptions: none
+Notes: none
+*/
+int findSchedulerCode( char* schedName )
+{
+   char nameStr[ MAX_STR_LEN ];
+   char registryStr[ MAX_STR_LEN ];
+   int index;
+
+   setStrToLowerCase( nameStr, schedName );
+
+   for( index = 0; index < schedulerCount; index++ )
+   {
+      setStrToLowerCase( registryStr, schedulerRegistry[ index ]->name );
+      if( compareString( nameStr, registryStr ) == STR_EQ )
+      {
+         return index;
+      }
+   }
+
+   return -1;
+}
+
+/*
+Function name: schedulerInit
+Algorithm: builds an empty run queue for the configured policy
+Precondition: loaded config data, count of processes in the run
+Postcondition: scheduler ready for enqueue calls
+Exceptions: none
+Notes: none
+*/
+void schedulerInit( Scheduler* scheduler, ConfigDataType* configDataPtr,
+                                                            int processCount )
+{
+   scheduler->policy = getSchedulerPolicy( configDataPtr->cpuSchedCode );
+   scheduler->state = scheduler->policy->init( processCount, configDataPtr );
+   scheduler->queueLength = 0;
+}
+
+/*
+Function name: schedulerEnqueue
+Algorithm: hands a READY process to the policy
+Precondition: process is READY, and not already queued
+Postcondition: process is in the run queue
+Exceptions: none
+Notes: none
+*/
+void schedulerEnqueue( Scheduler* scheduler, struct PCB* process )
+{
+   scheduler->policy->enqueue( scheduler->state, process );
+   scheduler->queueLength++;
+}
+
+/*
+Function name: schedulerPickNext
+Algorithm: asks the policy for the next process, and removes it
+Precondition: initialized scheduler
+Postcondition: returns the pId to run, or -1 if the queue is empty
+Exceptions: none
+Notes: none
+*/
+int schedulerPickNext( Scheduler* scheduler )
+{
+   if( scheduler->queueLength == 0 )
+   {
+      return -1;
+   }
+
+   scheduler->queueLength--;
+   return scheduler->policy->pickNext( scheduler->state );
+}
+
+/*
+Function name: schedulerPreempt
+Algorithm: tells the policy a process came off the CPU still READY, either
+            at the end of an op or with its quantum used up
+Precondition: process was RUNNING for ranMs
+Postcondition: process CPU time and policy bookkeeping updated, caller then
+               enqueues it
+Exceptions: none
+Notes: none
+*/
+void schedulerPreempt( Scheduler* scheduler, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed )
+{
+   process->cpuMs += ranMs;
+
+   if( scheduler->policy->onPreempt != NULL )
+   {
+      scheduler->policy->onPreempt( scheduler->state, process, ranMs,
+                                                               quantumUsed );
+   }
+}
+
+/*
+Function name: schedulerBlock
+Algorithm: tells the policy a process came off the CPU to wait on I/O
+Precondition: process was RUNNING for ranMs, now BLOCKED
+Postcondition: process CPU time and policy bookkeeping updated
+Exceptions: none
+Notes: none
+*/
+void schedulerBlock( Scheduler* scheduler, struct PCB* process, int ranMs )
+{
+   process->cpuMs += ranMs;
+
+   if( scheduler->policy->onBlock != NULL )
+   {
+      scheduler->policy->onBlock( scheduler->state, process, ranMs );
+   }
+}
+
+/*
+Function name: schedulerExit
+Algorithm: tells the policy a process has ended
+Precondition: process was RUNNING for ranMs, now EXIT
+Postcondition: process CPU time and policy bookkeeping updated
+Exceptions: none
+Notes: none
+*/
+void schedulerExit( Scheduler* scheduler, struct PCB* process, int ranMs )
+{
+   process->cpuMs += ranMs;
+
+   if( scheduler->policy->onExit != NULL )
+   {
+      scheduler->policy->onExit( scheduler->state, process, ranMs );
+   }
+}
+
+/*
+Function name: schedulerTimeSlice
+Algorithm: asks the policy how long the process may run before preemption
+Precondition: process about to run a P op
+Postcondition: returns the slice in ms, 0 for run to the end of the op
+Exceptions: none
+Notes: none
+*/
+int schedulerTimeSlice( Scheduler* scheduler, struct PCB* process )
+{
+   if( scheduler->policy->timeSlice == NULL )
+   {
+      return 0;
+   }
+
+   return scheduler->policy->timeSlice( scheduler->state, process );
+}
+
+/*
+Function name: schedulerDestruct
+Algorithm: frees the policy's ready structure
+Precondition: initialized scheduler
+Postcondition: state memory freed
+Exceptions: none
+Notes: none
+*/
+void schedulerDestruct( Scheduler* scheduler )
+{
+   scheduler->policy->destruct( scheduler->state );
+   scheduler->state = NULL;
+}
+
+/*
+Function name: schedulerSave
+Algorithm: writes the queue length, then has the policy write its state
+Precondition: initialized scheduler, file open for binary writing
+Postcondition: run queue written to the checkpoint
+Exceptions: none
+Notes: write errors are left on the file for the caller to check
+*/
+void schedulerSave( Scheduler* scheduler, int processCount, FILE* filePtr )
+{
+   fwrite( &scheduler->queueLength, sizeof( int ), 1, filePtr );
+   scheduler->policy->save( scheduler->state, processCount, filePtr );
+}
+
+/*
+Function name: schedulerRestore
+Algorithm: reads back what schedulerSave wrote
+Precondition: scheduler fresh from schedulerInit, with the same policy and
+              process count as the one saved
+Postcondition: returns True with the run queue as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+Boolean schedulerRestore( Scheduler* scheduler, int processCount,
+                                                             FILE* filePtr )
+{
+   if( fread( &scheduler->queueLength, sizeof( int ), 1, filePtr ) != 1 )
+   {
+      return False;
+   }
+
+   return scheduler->policy->restore( scheduler->state, processCount,
+                                                                  filePtr );
+}
+
+/*
+Function name: fcfsInit
+Algorithm: allocates an empty ready set sized for every process
+Precondition: count of processes in the run
+Postcondition: returns the ready set
+Exceptions: none
+Notes: also used by RR-P, which adds its quantum and position
+*/
+static void* fcfsInit( int processCount, ConfigDataType* configDataPtr )
+{
+   ReadySet* readySet = (ReadySet*) malloc( sizeof( ReadySet ) );
+
+   readySet->size = processCount;
+   readySet->tree = (int*) calloc( processCount + 1, sizeof( int ) );
+   readySet->pIdAt = (int*) calloc( processCount, sizeof( int ) );
+   readySet->count = 0;
+   readySet->lastPosition = -1;
+   readySet->quantumMs =
+                     configDataPtr->quantumCycles * configDataPtr->procCycleRate;
+
+   //highest power of two within the size, for the rank search
+   readySet->highBit = 1;
+   while( readySet->highBit * 2 <= processCount )
+   {
+      readySet->highBit *= 2;
+   }
+
+   return readySet;
+}
+
+/*
+Function name: fcfsEnqueue
+Algorithm: marks the process's arrival position as queued in the ready set
+Precondition: process not already queued
+Postcondition: process queued
+Exceptions: none
+Notes: O(log n)
+*/
+static void fcfsEnqueue( void* state, struct PCB* process )
+{
+   ReadySet* readySet = (ReadySet*) state;
+
+   readySet->pIdAt[ process->arrivalRank ] = process->pId;
+   readySetAdd( readySet, process->arrivalRank, 1 );
+}
+
+/*
+Function name: fcfsPickNext
+Algorithm: takes the lowest queued arrival position, the first come
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int fcfsPickNext( void* state )
+{
+   ReadySet* readySet = (ReadySet*) state;
+   int position = readySetFind( readySet, 1 );
+
+   readySetAdd( readySet, position, -1 );
+   return readySet->pIdAt[ position ];
+}
+
+/*
+Function name: fcfsDestruct
+Algorithm: frees the ready set
+Precondition: ready set from fcfsInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void fcfsDestruct( void* state )
+{
+   ReadySet* readySet = (ReadySet*) state;
+
+   free( readySet->tree );
+   free( readySet->pIdAt );
+   free( readySet );
+}
+
+/*
+Function name: fcfsSave
+Algorithm: writes the queued count, last position picked and both arrays
+Precondition: ready set from fcfsInit
+Postcondition: state written
+Exceptions: none
+Notes: also used by RR-P
+*/
+static void fcfsSave( void* state, int processCount, FILE* filePtr )
+{
+   ReadySet* readySet = (ReadySet*) state;
+
+   fwrite( &readySet->count, sizeof( int ), 1, filePtr );
+   fwrite( &readySet->lastPosition, sizeof( int ), 1, filePtr );
+   fwrite( readySet->tree, sizeof( int ), readySet->size + 1, filePtr );
+   fwrite( readySet->pIdAt, sizeof( int ), readySet->size, filePtr );
+}
+
+/*
+Function name: fcfsRestore
+Algorithm: reads back what fcfsSave wrote
+Precondition: ready set fresh from fcfsInit, sized as the one saved
+Postcondition: returns True with the ready set as it was saved
+Exceptions: returns False on a short read
+Notes: also used by RR-P
+*/
+static Boolean fcfsRestore( void* state, int processCount, FILE* filePtr )
+{
+   ReadySet* readySet = (ReadySet*) state;
+   size_t readCount = 0;
+
+   readCount += fread( &readySet->count, sizeof( int ), 1, filePtr );
+   readCount += fread( &readySet->lastPosition, sizeof( int ), 1, filePtr );
+   readCount += fread( readySet->tree, sizeof( int ), readySet->size + 1,
+                                                                  filePtr );
+   readCount += fread( readySet->pIdAt, sizeof( int ), readySet->size,
+                                                                  filePtr );
+
+   return readCount == (size_t) ( readySet->size * 2 + 3 ) ? True : False;
+}
+
+/*
+Function name: roundRobinPickNext
+Algorithm: takes the next queued arrival position after the last one
+            picked, wrapping back to the first queued position at the end
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int roundRobinPickNext( void* state )
+{
+   ReadySet* readySet = (ReadySet*) state;
+   int passed = readySetPrefix( readySet, readySet->lastPosition );
+   int position;
+
+   if( passed < readySet->count )
+   {
+      position = readySetFind( readySet, passed + 1 );
+   }
+   else
+   {
+      position = readySetFind( readySet, 1 );
+   }
+
+   readySet->lastPosition = position;
+   readySetAdd( readySet, position, -1 );
+   return readySet->pIdAt[ position ];
+}
+
+/*
+Function name: roundRobinTimeSlice
+Algorithm: every process gets the configured quantum
+Precondition: ready set from fcfsInit
+Postcondition: returns the quantum in ms
+Exceptions: none
+Notes: none
+*/
+static int roundRobinTimeSlice( void* state, struct PCB* process )
+{
+   return ( (ReadySet*) state )->quantumMs;
+}
+
+/*
+Function name: shortestJobInit
+Algorithm: allocates an empty heap of processes
+Precondition: count of processes in the run
+Postcondition: returns the policy state
+Exceptions: none
+Notes: none
+*/
+static void* shortestJobInit( int processCount, ConfigDataType* configDataPtr )
+{
+   ShortestJobState* jobState =
+                     (ShortestJobState*) malloc( sizeof( ShortestJobState ) );
+
+   processHeapInit( &jobState->heap, processCount + 1 );
+   return jobState;
+}
+
+/*
+Function name: shortestJobEnqueue
+Algorithm: keys the process by its remaining time
+Precondition: remaining time already charged for the run that just ended
+Postcondition: process queued
+Exceptions: none
+Notes: O(log n)
+*/
+static void shortestJobEnqueue( void* state, struct PCB* process )
+{
+   processHeapPush( &( (ShortestJobState*) state )->heap,
+                                       process->remainingTimeMs, process->pId );
+}
+
+/*
+Function name: shortestJobPickNext
+Algorithm: takes the least remaining time, lowest pId on a tie
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int shortestJobPickNext( void* state )
+{
+   return processHeapPop( &( (ShortestJobState*) state )->heap ).pId;
+}
+
+/*
+Function name: shortestJobDestruct
+Algorithm: frees the heap
+Precondition: state from shortestJobInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void shortestJobDestruct( void* state )
+{
+   processHeapDestruct( &( (ShortestJobState*) state )->heap );
+   free( state );
+}
+
+/*
+Function name: shortestJobSave
+Algorithm: writes the heap
+Precondition: state from shortestJobInit
+Postcondition: state written
+Exceptions: none
+Notes: none
+*/
+static void shortestJobSave( void* state, int processCount, FILE* filePtr )
+{
+   processHeapSave( &( (ShortestJobState*) state )->heap, filePtr );
+}
+
+/*
+Function name: shortestJobRestore
+Algorithm: reads back the heap
+Precondition: state fresh from shortestJobInit
+Postcondition: returns True with the heap as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean shortestJobRestore( void* state, int processCount,
+                                                             FILE* filePtr )
+{
+   return processHeapRestore( &( (ShortestJobState*) state )->heap, filePtr );
+}
+
+/*
+Function name: readySetAdd
+Algorithm: Fenwick tree update of one position
+Precondition: position within the set
+Postcondition: position count changed by delta
+Exceptions: none
+Notes: O(log n)
+*/
+static void readySetAdd( ReadySet* readySet, int position, int delta )
+{
+   int index;
+
+   readySet->count += delta;
+   for( index = position + 1; index <= readySet->size; index += index & -index )
+   {
+      readySet->tree[ index ] += delta;
+   }
+}
+
+/*
+Function name: readySetPrefix
+Algorithm: Fenwick tree prefix sum
+Precondition: position within the set, or -1
+Postcondition: returns how many queued positions are at or below position
+Exceptions: none
+Notes: O(log n)
+*/
+static int readySetPrefix( ReadySet* readySet, int position )
+{
+   int total = 0;
+   int index;
+
+   for( index = position + 1; index > 0; index -= index & -index )
+   {
+      total += readySet->tree[ index ];
+   }
+
+   return total;
+}
+
+/*
+Function name: readySetFind
+Algorithm: descends the Fenwick tree to the queued position of the given rank
+Precondition: 1 <= rank <= count
+Postcondition: returns the position
+Exceptions: none
+Notes: O(log n)
+*/
+static int readySetFind( ReadySet* readySet, int rank )
+{
+   int position = 0;
+   int step;
+
+   for( step = readySet->highBit; step > 0; step /= 2 )
+   {
+      if( position + step <= readySet->size
+                        && readySet->tree[ position + step ] < rank )
+      {
+         position += step;
+         rank -= readySet->tree[ position ];
+      }
+   }
+
+   //position is the last index below the rank, so the answer is the next one
+   return position;
+}
+
+/*
+Function name: processHeapInit
+Algorithm: allocates an empty heap
+Precondition: capacity of at least one
+Postcondition: empty heap
+Exceptions: none
+Notes: none
+*/
+void processHeapInit( ProcessHeap* heap, int capacity )
+{
+   heap->capacity = capacity > 0 ? capacity : 1;
+   heap->entries = (HeapEntry*) malloc( sizeof( HeapEntry ) * heap->capacity );
+   heap->size = 0;
+}
+
+/*
+Function name: processHeapPush
+Algorithm: places the entry at the bottom of the heap and sifts it up,
+            doubling the array when full
+Precondition: initialized heap
+Postcondition: entry stored
+Exceptions: none
+Notes: O(log n)
+*/
+void processHeapPush( ProcessHeap* heap, long long key, int pId )
+{
+   HeapEntry newEntry;
+   int childIndex, parentIndex;
+
+   //grow the heap if we have run out of room
+   if( heap->size == heap->capacity )
+   {
+      heap->capacity *= 2;
+      heap->entries = (HeapEntry*) realloc( heap->entries,
+                                       sizeof( HeapEntry ) * heap->capacity );
+   }
+
+   newEntry.key = key;
+   newEntry.pId = pId;
+
+   //sift up, moving parents down until our slot is found
+   childIndex = heap->size;
+   while( childIndex > 0 )
+   {
+      parentIndex = ( childIndex - 1 ) / 2;
+
+      if( heap->entries[ parentIndex ].key < key
+            || ( heap->entries[ parentIndex ].key == key
+                              && heap->entries[ parentIndex ].pId < pId ) )
+      {
+         break;
+      }
+
+      heap->entries[ childIndex ] = heap->entries[ parentIndex ];
+      childIndex = parentIndex;
+   }
+
+   heap->entries[ childIndex ] = newEntry;
+   heap->size++;
+}
+
+/*
+Function name: processHeapPop
+Algorithm: removes the root, moves the last entry to the root and sifts it
+            down below any smaller child
+Precondition: non-empty heap
+Postcondition: returns the smallest entry
+Exceptions: none
+Notes: O(log n)
+*/
+HeapEntry processHeapPop( ProcessHeap* heap )
+{
+   HeapEntry topEntry = heap->entries[ 0 ];
+   HeapEntry lastEntry;
+   int parentIndex = 0;
+   int childIndex;
+
+   heap->size--;
+   lastEntry = heap->entries[ heap->size ];
+
+   //sift down, moving the smaller child up until our slot is found
+   while( ( childIndex = parentIndex * 2 + 1 ) < heap->size )
+   {
+      if( childIndex + 1 < heap->size
+         && ( heap->entries[ childIndex + 1 ].key
+                                       < heap->entries[ childIndex ].key
+            || ( heap->entries[ childIndex + 1 ].key
+                                       == heap->entries[ childIndex ].key
+               && heap->entries[ childIndex + 1 ].pId
+                                       < heap->entries[ childIndex ].pId ) ) )
+      {
+         childIndex++;
+      }
+
+      if( lastEntry.key < heap->entries[ childIndex ].key
+            || ( lastEntry.key == heap->entries[ childIndex ].key
+                        && lastEntry.pId < heap->entries[ childIndex ].pId ) )
+      {
+         break;
+      }
+
+      heap->entries[ parentIndex ] = heap->entries[ childIndex ];
+      parentIndex = childIndex;
+   }
+
+   heap->entries[ parentIndex ] = lastEntry;
+   return topEntry;
+}
+
+/*
+Function name: processHeapDestruct
+Algorithm: frees the heap array
+Precondition: initialized heap
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+void processHeapDestruct( ProcessHeap* heap )
+{
+   free( heap->entries );
+   heap->entries = NULL;
+   heap->size = 0;
+}
+
+/*
+Function name: processHeapSave
+Algorithm: writes the size, then the entries in heap order
+Precondition: initialized heap, file open for binary writing
+Postcondition: heap written
+Exceptions: none
+Notes: none
+*/
+void processHeapSave( ProcessHeap* heap, FILE* filePtr )
+{
+   fwrite( &heap->size, sizeof( int ), 1, filePtr );
+   fwrite( heap->entries, sizeof( HeapEntry ), heap->size, filePtr );
+}
+
+/*
+Function name: processHeapRestore
+Algorithm: reads the size, grows the heap to hold it, then reads the entries
+Precondition: initialized heap
+Postcondition: returns True with the heap as it was saved
+Exceptions: returns False on a short read or a negative size
+Notes: none
+*/
+Boolean processHeapRestore( ProcessHeap* heap, FILE* filePtr )
+{
+   int size;
+
+   if( fread( &size, sizeof( int ), 1, filePtr ) != 1 || size < 0 )
+   {
+      return False;
+   }
+
+   if( size > heap->capacity )
+   {
+      heap->capacity = size;
+      heap->entries = (HeapEntry*) realloc( heap->entries,
+                                       sizeof( HeapEntry ) * heap->capacity );
+   }
+
+   heap->size = size;
+   return fread( heap->entries, sizeof( HeapEntry ), size, filePtr )
+                                             == (size_t) size ? True : False;
+}
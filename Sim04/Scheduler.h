@@ -0,0 +1,105 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file Scheduler.h
+ *
+ * @version 5.40
+ *          Kristopher Moore (19 October 2026)
+ *          Pluggable CPU scheduling policies, registered by name.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "ConfigAccess.h"
+
+//share weight of a process with no weight of its own, CFS scales virtual
+//runtime by this over the process's weight
+#define SCHED_DEFAULT_WEIGHT 1024
+
+//PCB is defined in SimRunner.h, policies only ever pass it by pointer
+struct PCB;
+
+//CPU scheduling policy, one entry in the registry per "CPU Scheduling Code"
+//NOTE: init builds the policy's own ready structure, and every other call
+//      is given it back as state. onPreempt, onBlock, onExit and timeSlice
+//      may be NULL when a policy has no use for them. save writes the state
+//      to a checkpoint, and restore reads it back into a state fresh from
+//      init for the same run, returning False on a short read
+typedef struct
+{
+   char* name;
+   Boolean preemptive;
+   void* (*init)( int processCount, ConfigDataType* configDataPtr );
+   void (*enqueue)( void* state, struct PCB* process );
+   int (*pickNext)( void* state );
+   void (*onPreempt)( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed );
+   void (*onBlock)( void* state, struct PCB* process, int ranMs );
+   void (*onExit)( void* state, struct PCB* process, int ranMs );
+   int (*timeSlice)( void* state, struct PCB* process );
+   void (*destruct)( void* state );
+   void (*save)( void* state, int processCount, FILE* filePtr );
+   Boolean (*restore)( void* state, int processCount, FILE* filePtr );
+
+} SchedulerPolicy;
+
+//one run queue, a policy and its state, each CPU core owns one
+typedef struct
+{
+   const SchedulerPolicy* policy;
+   void* state;
+   int queueLength;
+
+} Scheduler;
+
+//binary min-heap of processes, ordered by key then by pId
+typedef struct
+{
+   long long key;
+   int pId;
+
+} HeapEntry;
+
+typedef struct
+{
+   HeapEntry* entries;
+   int size;
+   int capacity;
+
+} ProcessHeap;
+
+//policies defined in their own files, listed in the registry
+extern const SchedulerPolicy mlfqPPolicy;
+extern const SchedulerPolicy cfsPPolicy;
+extern const SchedulerPolicy lotteryPPolicy;
+extern const SchedulerPolicy stridePPolicy;
+extern const SchedulerPolicy edfPPolicy;
+
+//function prototypes for the registry
+const SchedulerPolicy* getSchedulerPolicy( int schedCode );
+int findSchedulerCode( char* schedName );
+
+//function prototypes for a run queue
+void schedulerInit( Scheduler* scheduler, ConfigDataType* configDataPtr,
+                                                            int processCount );
+void schedulerEnqueue( Scheduler* scheduler, struct PCB* process );
+int schedulerPickNext( Scheduler* scheduler );
+void schedulerPreempt( Scheduler* scheduler, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed );
+void schedulerBlock( Scheduler* scheduler, struct PCB* process, int ranMs );
+void schedulerExit( Scheduler* scheduler, struct PCB* process, int ranMs );
+int schedulerTimeSlice( Scheduler* scheduler, struct PCB* process );
+void schedulerDestruct( Scheduler* scheduler );
+void schedulerSave( Scheduler* scheduler, int processCount, FILE* filePtr );
+Boolean schedulerRestore( Scheduler* scheduler, int processCount,
+                                                            FILE* filePtr );
+
+//function prototypes for the process heap
+void processHeapInit( ProcessHeap* heap, int capacity );
+void processHeapPush( ProcessHeap* heap, long long key, int pId );
+HeapEntry processHeapPop( ProcessHeap* heap );
+void processHeapDestruct( ProcessHeap* heap );
+void processHeapSave( ProcessHeap* heap, FILE* filePtr );
+Boolean processHeapRestore( ProcessHeap* heap, FILE* filePtr );
+
+#endif // SCHEDULER_H
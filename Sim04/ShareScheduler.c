@@ -0,0 +1,436 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file ShareScheduler.c
+ *
+ *
+ * @version 5.43
+ *          Kristopher Moore (19 October 2026)
+ *          Proportional share scheduling policies, LOTTERY-P and STRIDE-P.
+ */
+
+//needs simRunner for the PCB definition
+#include "SimRunner.h"
+
+//pass distance of one ms of CPU time for a process holding one ticket
+#define STRIDE_ONE_MS ( 1LL << 20 )
+
+//lottery state, a Fenwick tree over pIds holding each queued process's
+//tickets, so a draw is a prefix search in O(log n)
+typedef struct
+{
+   long long* tree;
+   int* tickets;
+   int size;
+   int highBit;
+   long long totalTickets;
+   unsigned long long randomState;
+   int quantumMs;
+
+} LotteryState;
+
+//stride state, a heap of queued processes keyed by pass
+typedef struct
+{
+   ProcessHeap heap;
+   long long* pass;
+   long long globalPass;
+   int quantumMs;
+
+} StrideState;
+
+//static helpers
+static void lotteryAdd( LotteryState* lottery, int pId, long long delta );
+static int lotteryFind( LotteryState* lottery, long long ticket );
+
+//policy callbacks, LOTTERY-P
+static void* lotteryInit( int processCount, ConfigDataType* configDataPtr );
+static void lotteryEnqueue( void* state, struct PCB* process );
+static int lotteryPickNext( void* state );
+static int lotteryTimeSlice( void* state, struct PCB* process );
+static void lotteryDestruct( void* state );
+static void lotterySave( void* state, int processCount, FILE* filePtr );
+static Boolean lotteryRestore( void* state, int processCount, FILE* filePtr );
+
+//policy callbacks, STRIDE-P
+static void* strideInit( int processCount, ConfigDataType* configDataPtr );
+static void strideEnqueue( void* state, struct PCB* process );
+static int stridePickNext( void* state );
+static void stridePreempt( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed );
+static void strideBlock( void* state, struct PCB* process, int ranMs );
+static void strideExit( void* state, struct PCB* process, int ranMs );
+static int strideTimeSlice( void* state, struct PCB* process );
+static void strideDestruct( void* state );
+static void strideSave( void* state, int processCount, FILE* filePtr );
+static Boolean strideRestore( void* state, int processCount, FILE* filePtr );
+
+const SchedulerPolicy lotteryPPolicy =
+   { "LOTTERY-P", True, lotteryInit, lotteryEnqueue, lotteryPickNext,
+        NULL, NULL, NULL, lotteryTimeSlice, lotteryDestruct,
+                                                lotterySave, lotteryRestore };
+
+const SchedulerPolicy stridePPolicy =
+   { "STRIDE-P", True, strideInit, strideEnqueue, stridePickNext,
+        stridePreempt, strideBlock, strideExit, strideTimeSlice,
+                                    strideDestruct, strideSave, strideRestore };
+
+/*
+Function name: lotteryInit
+Algorithm: allocates an empty ticket tree sized for every pId, and seeds the
+            draws from the config
+Precondition: count of processes in the run
+Postcondition: returns the lottery state
+Exceptions: none
+Notes: none
+*/
+static void* lotteryInit( int processCount, ConfigDataType* configDataPtr )
+{
+   LotteryState* lottery = (LotteryState*) malloc( sizeof( LotteryState ) );
+
+   lottery->size = processCount;
+   lottery->tree = (long long*) calloc( processCount + 1, sizeof( long long ) );
+   lottery->tickets = (int*) calloc( processCount, sizeof( int ) );
+   lottery->totalTickets = 0;
+   lottery->quantumMs =
+                     configDataPtr->quantumCycles * configDataPtr->procCycleRate;
+
+   lottery->randomState = seedRandom( configDataPtr->randomSeed );
+
+   //highest power of two within the size, for the prefix search
+   lottery->highBit = 1;
+   while( lottery->highBit * 2 <= processCount )
+   {
+      lottery->highBit *= 2;
+   }
+
+   return lottery;
+}
+
+/*
+Function name: lotteryEnqueue
+Algorithm: adds the process's tickets to the tree
+Precondition: process not already queued
+Postcondition: process queued
+Exceptions: none
+Notes: O(log n)
+*/
+static void lotteryEnqueue( void* state, struct PCB* process )
+{
+   LotteryState* lottery = (LotteryState*) state;
+
+   lottery->tickets[ process->pId ] = process->weight;
+   lotteryAdd( lottery, process->pId, process->weight );
+}
+
+/*
+Function name: lotteryPickNext
+Algorithm: draws a ticket from all queued tickets, and removes the process
+            holding it
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int lotteryPickNext( void* state )
+{
+   LotteryState* lottery = (LotteryState*) state;
+   long long ticket = (long long) ( nextRandom( &lottery->randomState )
+                        % (unsigned long long) lottery->totalTickets );
+   int pId = lotteryFind( lottery, ticket );
+
+   lotteryAdd( lottery, pId, -lottery->tickets[ pId ] );
+   return pId;
+}
+
+/*
+Function name: lotteryTimeSlice
+Algorithm: every winner runs for one quantum
+Precondition: process about to run a P op
+Postcondition: returns the slice in ms
+Exceptions: none
+Notes: none
+*/
+static int lotteryTimeSlice( void* state, struct PCB* process )
+{
+   return ( (LotteryState*) state )->quantumMs;
+}
+
+/*
+Function name: lotteryDestruct
+Algorithm: frees the ticket tree and the state
+Precondition: state from lotteryInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void lotteryDestruct( void* state )
+{
+   LotteryState* lottery = (LotteryState*) state;
+
+   free( lottery->tree );
+   free( lottery->tickets );
+   free( lottery );
+}
+
+/*
+Function name: lotterySave
+Algorithm: writes the ticket total, the draw state and both arrays
+Precondition: state from lotteryInit
+Postcondition: state written
+Exceptions: none
+Notes: none
+*/
+static void lotterySave( void* state, int processCount, FILE* filePtr )
+{
+   LotteryState* lottery = (LotteryState*) state;
+
+   fwrite( &lottery->totalTickets, sizeof( long long ), 1, filePtr );
+   fwrite( &lottery->randomState, sizeof( unsigned long long ), 1, filePtr );
+   fwrite( lottery->tree, sizeof( long long ), lottery->size + 1, filePtr );
+   fwrite( lottery->tickets, sizeof( int ), lottery->size, filePtr );
+}
+
+/*
+Function name: lotteryRestore
+Algorithm: reads back what lotterySave wrote, so the draws carry on where
+            they left off
+Precondition: state fresh from lotteryInit, sized as the one saved
+Postcondition: returns True with the state as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean lotteryRestore( void* state, int processCount, FILE* filePtr )
+{
+   LotteryState* lottery = (LotteryState*) state;
+   size_t readCount = 0;
+
+   readCount += fread( &lottery->totalTickets, sizeof( long long ), 1,
+                                                                  filePtr );
+   readCount += fread( &lottery->randomState, sizeof( unsigned long long ), 1,
+                                                                  filePtr );
+   readCount += fread( lottery->tree, sizeof( long long ), lottery->size + 1,
+                                                                  filePtr );
+   readCount += fread( lottery->tickets, sizeof( int ), lottery->size,
+                                                                  filePtr );
+
+   return readCount == (size_t) ( lottery->size * 2 + 3 ) ? True : False;
+}
+
+/*
+Function name: lotteryAdd
+Algorithm: adds delta tickets at the pId, and to the total
+Precondition: pId in range
+Postcondition: tree and total updated
+Exceptions: none
+Notes: O(log n)
+*/
+static void lotteryAdd( LotteryState* lottery, int pId, long long delta )
+{
+   int index;
+
+   lottery->totalTickets += delta;
+
+   for( index = pId + 1; index <= lottery->size; index += index & -index )
+   {
+      lottery->tree[ index ] += delta;
+   }
+}
+
+/*
+Function name: lotteryFind
+Algorithm: descends the tree for the lowest pId whose running ticket total
+            is past the drawn ticket
+Precondition: ticket below the total of queued tickets
+Postcondition: returns the pId holding the ticket
+Exceptions: none
+Notes: O(log n)
+*/
+static int lotteryFind( LotteryState* lottery, long long ticket )
+{
+   int position = 0;
+   int bit;
+
+   for( bit = lottery->highBit; bit > 0; bit /= 2 )
+   {
+      if( position + bit <= lottery->size
+                              && lottery->tree[ position + bit ] <= ticket )
+      {
+         position += bit;
+         ticket -= lottery->tree[ position ];
+      }
+   }
+
+   return position;
+}
+
+/*
+Function name: strideInit
+Algorithm: allocates an empty pass heap and a pass per pId
+Precondition: count of processes in the run
+Postcondition: returns the stride state
+Exceptions: none
+Notes: none
+*/
+static void* strideInit( int processCount, ConfigDataType* configDataPtr )
+{
+   StrideState* stride = (StrideState*) malloc( sizeof( StrideState ) );
+
+   processHeapInit( &stride->heap, processCount );
+   stride->pass = (long long*) calloc( processCount, sizeof( long long ) );
+   stride->globalPass = 0;
+   stride->quantumMs =
+                     configDataPtr->quantumCycles * configDataPtr->procCycleRate;
+
+   return stride;
+}
+
+/*
+Function name: strideEnqueue
+Algorithm: pushes the process by its pass, a process back from I/O or new
+            to the core is first moved up to the pass last dispatched
+Precondition: process not already queued
+Postcondition: process queued
+Exceptions: none
+Notes: O(log n)
+*/
+static void strideEnqueue( void* state, struct PCB* process )
+{
+   StrideState* stride = (StrideState*) state;
+
+   if( stride->pass[ process->pId ] < stride->globalPass )
+   {
+      stride->pass[ process->pId ] = stride->globalPass;
+   }
+
+   processHeapPush( &stride->heap, stride->pass[ process->pId ],
+                                                               process->pId );
+}
+
+/*
+Function name: stridePickNext
+Algorithm: pops the least pass, and advances the global pass to it
+Precondition: at least one process queued
+Postcondition: returns the pId, no longer queued
+Exceptions: none
+Notes: O(log n)
+*/
+static int stridePickNext( void* state )
+{
+   StrideState* stride = (StrideState*) state;
+   HeapEntry entry = processHeapPop( &stride->heap );
+
+   stride->globalPass = entry.key;
+   return entry.pId;
+}
+
+/*
+Function name: stridePreempt
+Algorithm: advances the process's pass by its stride for each ms it ran
+Precondition: process was RUNNING for ranMs
+Postcondition: pass updated
+Exceptions: none
+Notes: charging the time run, not a whole quantum, keeps shares exact when
+       ops end early
+*/
+static void stridePreempt( void* state, struct PCB* process, int ranMs,
+                                                         Boolean quantumUsed )
+{
+   StrideState* stride = (StrideState*) state;
+
+   stride->pass[ process->pId ] += ranMs * STRIDE_ONE_MS / process->weight;
+}
+
+/*
+Function name: strideBlock
+Algorithm: advances the process's pass by its stride for each ms it ran
+Precondition: process was RUNNING for ranMs, now BLOCKED
+Postcondition: pass updated
+Exceptions: none
+Notes: none
+*/
+static void strideBlock( void* state, struct PCB* process, int ranMs )
+{
+   stridePreempt( state, process, ranMs, False );
+}
+
+/*
+Function name: strideExit
+Algorithm: advances the process's pass for its last run
+Precondition: process was RUNNING for ranMs, now EXIT
+Postcondition: pass updated
+Exceptions: none
+Notes: none
+*/
+static void strideExit( void* state, struct PCB* process, int ranMs )
+{
+   stridePreempt( state, process, ranMs, False );
+}
+
+/*
+Function name: strideTimeSlice
+Algorithm: every process runs for one quantum
+Precondition: process about to run a P op
+Postcondition: returns the slice in ms
+Exceptions: none
+Notes: none
+*/
+static int strideTimeSlice( void* state, struct PCB* process )
+{
+   return ( (StrideState*) state )->quantumMs;
+}
+
+/*
+Function name: strideDestruct
+Algorithm: frees the pass heap, the passes and the state
+Precondition: state from strideInit
+Postcondition: memory freed
+Exceptions: none
+Notes: none
+*/
+static void strideDestruct( void* state )
+{
+   StrideState* stride = (StrideState*) state;
+
+   processHeapDestruct( &stride->heap );
+   free( stride->pass );
+   free( stride );
+}
+
+/*
+Function name: strideSave
+Algorithm: writes the global pass, the heap and the pass of every pId
+Precondition: state from strideInit
+Postcondition: state written
+Exceptions: none
+Notes: none
+*/
+static void strideSave( void* state, int processCount, FILE* filePtr )
+{
+   StrideState* stride = (StrideState*) state;
+
+   fwrite( &stride->globalPass, sizeof( long long ), 1, filePtr );
+   processHeapSave( &stride->heap, filePtr );
+   fwrite( stride->pass, sizeof( long long ), processCount, filePtr );
+}
+
+/*
+Function name: strideRestore
+Algorithm: reads back what strideSave wrote
+Precondition: state fresh from strideInit, for the same process count
+Postcondition: returns True with the state as it was saved
+Exceptions: returns False on a short read
+Notes: none
+*/
+static Boolean strideRestore( void* state, int processCount, FILE* filePtr )
+{
+   StrideState* stride = (StrideState*) state;
+
+   if( fread( &stride->globalPass, sizeof( long long ), 1, filePtr ) != 1
+            || processHeapRestore( &stride->heap, filePtr ) == False )
+   {
+      return False;
+   }
+
+   return fread( stride->pass, sizeof( long long ), processCount, filePtr )
+                                    == (size_t) processCount ? True : False;
+}
@@ -17,15 +17,17 @@ Function name: main
 Algorithm: driver function to test config and metadata file
            upload operation together
 Precondition: none
-Postcondition: returns zero (0) on success
+Postcondition: returns zero (0) on success, or the runner's failure code
 Exceptions: none
-Notes: demonstrates use of combined files
+Notes: demonstrates use of combined files, "--restore file.ckp" after the
+       config file resumes a virtual clock run from its checkpoint, and
+       "--replay file.irr" replays a recording of its interrupts
 */
 int main( int argc, char **argv )
 {
 
    // initialization
-   int configAccessResult, mdAccessResult;
+   int configAccessResult, mdAccessResult, runResult;
    char configFileName[ MAX_STR_LEN ];
    char mdFileName[ MAX_STR_LEN ];
    ConfigDataType *configDataPtr;
@@ -62,6 +64,48 @@ int main( int argc, char **argv )
       return 0;
    }
 
+   // check for a checkpoint to resume from, only a virtual clock has one,
+   // or for a recording of interrupts to replay, always on a virtual clock
+   if( argc == 4 && compareString( argv[ 2 ], "--replay" ) == STR_EQ )
+   {
+      // the path has to fit the config's file name field
+      if( getStringLength( argv[ 3 ] )
+                           >= (int) sizeof( configDataPtr->replayFileName ) )
+      {
+         printf( "ERROR: replay file name is too long\n" );
+         printf( "Program Terminated\n" );
+         clearConfigData( &configDataPtr );
+         return 1;
+      }
+
+      copyString( configDataPtr->replayFileName, argv[ 3 ] );
+      configDataPtr->simClockCode = SIM_CLOCK_VIRTUAL_CODE;
+   }
+   else if( argc > 2 )
+   {
+      if( argc != 4 || compareString( argv[ 2 ], "--restore" ) != STR_EQ
+            || configDataPtr->simClockCode != SIM_CLOCK_VIRTUAL_CODE )
+      {
+         printf( "ERROR: only --restore file.ckp, for a virtual clock run,"
+                     " or --replay file.irr may follow the config file\n" );
+         printf( "Program Terminated\n" );
+         clearConfigData( &configDataPtr );
+         return 1;
+      }
+
+      // the path has to fit the config's file name field
+      if( getStringLength( argv[ 3 ] )
+                           >= (int) sizeof( configDataPtr->restoreFileName ) )
+      {
+         printf( "ERROR: restore file name is too long\n" );
+         printf( "Program Terminated\n" );
+         clearConfigData( &configDataPtr );
+         return 1;
+      }
+
+      copyString( configDataPtr->restoreFileName, argv[ 3 ] );
+   }
+
    //display start of meta data upload
    printf( "\nUploading Meta Data Files\n\n" );
 
@@ -78,7 +122,15 @@ int main( int argc, char **argv )
    }
    
    //If we reach this point, we have our correct files, so we can begin sim
-   simulationRunner( configDataPtr, mdData);
+   //a virtual clock runs from the event calendar, otherwise in real time
+   if( configDataPtr->simClockCode == SIM_CLOCK_VIRTUAL_CODE )
+   {
+      runResult = eventSimulationRunner( configDataPtr, mdData, NULL );
+   }
+   else
+   {
+      runResult = simulationRunner( configDataPtr, mdData, NULL );
+   }
    
    
    // shut down, clean up program
@@ -90,6 +142,6 @@ int main( int argc, char **argv )
    mdData = clearMetaDataList( mdData );
    printf( "\n" );
 
-   // return successful exit of our program
-   return 0;
+   // return our exit, non zero when a restore or replay failed
+   return runResult;
 }
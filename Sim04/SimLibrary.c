@@ -0,0 +1,200 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file SimLibrary.c
+ *
+ *
+ * @version 5.51
+ *          Kristopher Moore (19 October 2026)
+ *          Embedding interface, runs simulations from memory buffers.
+ */
+
+//fmemopen is POSIX 2008, not C99
+#define _POSIX_C_SOURCE 200809L
+
+#include "SimLibrary.h"
+
+/*
+Function name: simCreate
+Algorithm: allocates a simulation with nothing loaded
+Precondition: none
+Postcondition: returns the simulation, NULL when out of memory
+Exceptions: none
+Notes: release with simDestruct
+*/
+Simulation* simCreate( void )
+{
+   Simulation* sim = (Simulation*) malloc( sizeof( Simulation ) );
+
+   if( sim != NULL )
+   {
+      sim->configDataPtr = NULL;
+      sim->mdData = NULL;
+      sim->eventCallback = NULL;
+      sim->eventUserData = NULL;
+   }
+
+   return sim;
+}
+
+/*
+Function name: simLoadConfig
+Algorithm: reads the buffer as a config file through a memory stream,
+            replacing any config loaded before
+Precondition: sim from simCreate, buffer holds length bytes of a config file
+Postcondition: returns NO_ERR with the config loaded, otherwise the same
+               error getConfigData would give for a file of those bytes
+Exceptions: CFG_FILE_ACCESS_ERR when the buffer is empty or can not be read
+Notes: the config's meta data file name is ignored, meta data comes from
+       simLoadMetaData
+*/
+int simLoadConfig( Simulation* sim, const char* buffer, size_t length )
+{
+   FILE* bufferStream;
+   ConfigDataType* configDataPtr;
+   int accessResult;
+
+   if( buffer == NULL || length == 0 )
+   {
+      return CFG_FILE_ACCESS_ERR;
+   }
+
+   bufferStream = fmemopen( (void*) buffer, length, "r" );
+
+   if( bufferStream == NULL )
+   {
+      return CFG_FILE_ACCESS_ERR;
+   }
+
+   accessResult = readConfigData( bufferStream, &configDataPtr );
+   fclose( bufferStream );
+
+   if( accessResult == NO_ERR )
+   {
+      clearConfigData( &sim->configDataPtr );
+      sim->configDataPtr = configDataPtr;
+   }
+
+   return accessResult;
+}
+
+/*
+Function name: simLoadMetaData
+Algorithm: reads the buffer as a meta data file through a memory stream,
+            replacing any meta data loaded before
+Precondition: sim from simCreate, buffer holds length bytes of a meta data
+              file
+Postcondition: returns NO_ERR with the op codes loaded, otherwise the same
+               error getOpCodes would give for a file of those bytes
+Exceptions: MD_FILE_ACCESS_ERR when the buffer is empty or can not be read
+Notes: none
+*/
+int simLoadMetaData( Simulation* sim, const char* buffer, size_t length )
+{
+   FILE* bufferStream;
+   OpCodeType* mdData;
+   int accessResult;
+
+   if( buffer == NULL || length == 0 )
+   {
+      return MD_FILE_ACCESS_ERR;
+   }
+
+   bufferStream = fmemopen( (void*) buffer, length, "r" );
+
+   if( bufferStream == NULL )
+   {
+      return MD_FILE_ACCESS_ERR;
+   }
+
+   accessResult = readOpCodes( bufferStream, &mdData );
+   fclose( bufferStream );
+
+   //an error mid list still returns, but leaves the list cleared
+   if( accessResult == NO_ERR && mdData == NULL )
+   {
+      accessResult = MD_CORRUPT_DESCRIPTOR_ERR;
+   }
+
+   if( accessResult == NO_ERR )
+   {
+      sim->mdData = clearMetaDataList( sim->mdData );
+      sim->mdData = mdData;
+   }
+
+   return accessResult;
+}
+
+/*
+Function name: simSetEventCallback
+Algorithm: remembers the callback for the next simRun
+Precondition: sim from simCreate
+Postcondition: callback is called with every event logged by later runs,
+               a NULL callback stops the calls
+Exceptions: none
+Notes: each event is passed straight from the event logger, its strings
+       only last for the call. Runs on a real time clock call it from
+       their core threads, one call at a time
+*/
+void simSetEventCallback( Simulation* sim, EventCallback callback,
+                                                            void* userData )
+{
+   sim->eventCallback = callback;
+   sim->eventUserData = userData;
+}
+
+/*
+Function name: simRun
+Algorithm: runs the loaded config over the loaded meta data, on the clock
+            the config asks for
+Precondition: sim has a config and meta data loaded
+Postcondition: returns NO_ERR and fills runSummaryPtr when it is not NULL
+Exceptions: CFG_FILE_ACCESS_ERR with no config loaded,
+            MD_FILE_ACCESS_ERR with no meta data loaded
+Notes: the loaded data is only read, so a simulation may be run again
+*/
+int simRun( Simulation* sim, RunSummary* runSummaryPtr )
+{
+   if( sim->configDataPtr == NULL )
+   {
+      return CFG_FILE_ACCESS_ERR;
+   }
+
+   if( sim->mdData == NULL )
+   {
+      return MD_FILE_ACCESS_ERR;
+   }
+
+   sim->configDataPtr->eventCallback = sim->eventCallback;
+   sim->configDataPtr->eventUserData = sim->eventUserData;
+
+   if( sim->configDataPtr->simClockCode == SIM_CLOCK_VIRTUAL_CODE )
+   {
+      eventSimulationRunner( sim->configDataPtr, sim->mdData, runSummaryPtr );
+   }
+   else
+   {
+      simulationRunner( sim->configDataPtr, sim->mdData, runSummaryPtr );
+   }
+
+   return NO_ERR;
+}
+
+/*
+Function name: simDestruct
+Algorithm: frees the loaded config and meta data, then the simulation
+Precondition: sim from simCreate, or NULL
+Postcondition: memory released, returns NULL
+Exceptions: none
+Notes: none
+*/
+Simulation* simDestruct( Simulation* sim )
+{
+   if( sim != NULL )
+   {
+      clearConfigData( &sim->configDataPtr );
+      sim->mdData = clearMetaDataList( sim->mdData );
+      free( sim );
+   }
+
+   return NULL;
+}
@@ -0,0 +1,37 @@
+//Header File Information//////////////////////////////////////////////////////
+/*
+ * @file SimLibrary.h
+ *
+ * @version 5.51
+ *          Kristopher Moore (19 October 2026)
+ *          Embedding interface, runs simulations from memory buffers.
+ */
+
+#ifndef SIM_LIBRARY_H
+#define SIM_LIBRARY_H
+
+#include "SimRunner.h"
+
+//one embedded simulation, its config and meta data, and who hears its events
+//NOTE: separate simulations may run on separate threads at once, only one
+//      of them at a time writes a trace file or serves a metrics socket,
+//      others naming one run without it
+typedef struct
+{
+   ConfigDataType* configDataPtr;
+   OpCodeType* mdData;
+   EventCallback eventCallback;
+   void* eventUserData;
+
+} Simulation;
+
+//function prototypes for SimLibrary.c
+Simulation* simCreate( void );
+int simLoadConfig( Simulation* sim, const char* buffer, size_t length );
+int simLoadMetaData( Simulation* sim, const char* buffer, size_t length );
+void simSetEventCallback( Simulation* sim, EventCallback callback,
+                                                            void* userData );
+int simRun( Simulation* sim, RunSummary* runSummaryPtr );
+Simulation* simDestruct( Simulation* sim );
+
+#endif // SIM_LIBRARY_H
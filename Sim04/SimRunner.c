@@ -9,20 +9,25 @@
  *          Scheduler / Thread Extensions
  */
 
+#include <sched.h>
+#include <math.h>
 #include "SimRunner.h"
  
 /*
 Function name: simulationRunner
 Algorithm: utilizes metadata and config data to create processes with PCBs,
-            then uses a scheduler to select a process, and iterates through them
+            then starts one thread per CPU core. Each core uses a scheduler 
+            to select a process from its run queue, and iterates through them
             using timer functions to emulate a running. Pthreads are used for
             I/O ops.
 Precondition: correctly configured config.cnf and metadata.mdf files
-Postcondition: simulates in accordance with specifications of config file
+Postcondition: simulates in accordance with specifications of config file,
+               and fills runSummaryPtr when it is not NULL
 Exceptions: none
 Notes: none
 */
-int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
+int simulationRunner( ConfigDataType* configDataPtr, OpCodeType* mdData,
+                                                   RunSummary* runSummaryPtr )
 {
    //initializations///////////////////////////////////////////////////////////
    char timeString[MAX_STR_LEN];
@@ -35,25 +40,33 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
    MMU* mmuCurrentPtr = NULL;
    char checkIfFile[STD_STR_LEN];
    OpCodeType* loopMetaDataPtr = mdData;
-   OpCodeType* currentProgramCounter;
    PCB* process = NULL;
    int processCount = 0;
+   int coreCount = configDataPtr->cpuCores;
    int indexI = 0;
    int scheduledProcess = 0;
-   int oldScheduledProcess = 0;
-   int segFaultFlag = 0;
-   int interruptedPid = 0;
-   Boolean idleFlag = False;
-   Boolean processingFlag = True;
-   Boolean isFirstRun = True;
+   long long startUs = 0;
+   InterruptStats interruptStats = { 0, 0, 0 };
+   DeadlineStats deadlineStats = { 0, 0, 0, 0 };
+   LatencyStats latencyStats;
+   RunSummary runSummary;
+   EventQueue arrivalQueue;
+   Boolean staggeredArrivals = False;
    EventData eventData;
+   DeviceTable deviceTable;
+   Scheduler schedulers[coreCount];
+   CoreContext coreContexts[coreCount];
+   Boolean coresBusy[coreCount];
+   CoreStats coreStats[coreCount];
+   pthread_t coreThreads[coreCount];
+   SimContext simContext;
+   PROFILE_BEGIN( PROF_RUN );
    
    //buffer in a value for completeLog, to avoid unintialized access
    copyString( completeLog, " " );
    
    //IMPORTANT: initialization steps for our Logging linked list,
-   newNodePtr = ( LogLinkedList * ) malloc( sizeof( LogLinkedList ) );
-   copyString( newNodePtr->logLine, " " );                              
+   newNodePtr = createLogNode( " " );
    listCurrentPtr = addNodeLL( listCurrentPtr, newNodePtr );
    listHeadPtr = listCurrentPtr;                             
    copyString( listCurrentPtr->logLine, " " );
@@ -70,18 +83,26 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
    
    
    //Start Event Logging////////////////////////////////////////////////////////
-   printf( "==========================\n" );
-   printf( "Begin Simulation\n\n" );
+   if( configDataPtr->logToCode != LOGTO_NONE_CODE )
+   {
+      printf( "==========================\n" );
+      printf( "Begin Simulation\n\n" );
+   }
    
    
+   //the trace and the metrics socket, if asked for, follow every event
+   //from here on
+   traceOpen( configDataPtr );
+   metricsOpen( configDataPtr, True );
+   
    //EVENT LOG: System Start
-   accessTimer( ZERO_TIMER, timeString );
+   accessTimer( &simContext.simTimer, ZERO_TIMER, timeString );
    eventData = generateEventData( OS, SystemStart, timeString, mdData, process);
    eventLogger( eventData, configDataPtr, listCurrentPtr );
    
    
    //EVENT LOG: Create PCB'S
-   accessTimer( LAP_TIMER, timeString );
+   accessTimer( &simContext.simTimer, LAP_TIMER, timeString );
    eventData = generateEventData( OS, CreatePCBs, timeString, mdData, process );
    eventLogger( eventData, configDataPtr, listCurrentPtr );
    
@@ -94,47 +115,254 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
    //And initilize each in NEW state / attach their Program Counter
    PCB pcbArray[processCount];
    createPCBs( pcbArray, loopMetaDataPtr, processCount );
+   metricsSet( configDataPtr, METRIC_PROCESSES_NEW, processCount );
+   assignCores( pcbArray, processCount, coreCount );
    
-   //IMPORTANT: initialization of interruptQueue
-   interruptQueue(INIT, 0, processCount);
+   //IMPORTANT: initialization of interruptQueue, and of its recording,
+   //which keeps times from the zero of the log's timer
+   interruptQueue( &simContext.interruptQueue, INIT, 0, processCount );
+   recordOpen( &simContext.recorder, configDataPtr, processCount,
+            (long long) simContext.simTimer.startSec * 1000000
+                                 + simContext.simTimer.startUSec, True );
+   simContext.interruptQueue.recorder = &simContext.recorder;
+   simContext.interruptQueue.configDataPtr = configDataPtr;
    
    //EVENT LOG: All Processes init in NEW
-   accessTimer( LAP_TIMER, timeString );
+   accessTimer( &simContext.simTimer, LAP_TIMER, timeString );
    eventData = generateEventData( OS, AllProcNEW, timeString, mdData, process );
    eventLogger( eventData, configDataPtr, listCurrentPtr );
    
-   //EVENT LOG: All Processes init in READY
-   accessTimer( LAP_TIMER, timeString );
-   eventData = generateEventData( OS, AllProcREADY, timeString,
+   //Calculate each of the remaining times, and arrival times, on each Process
+   calcRemainingTimes( pcbArray, configDataPtr, processCount );
+   staggeredArrivals = assignArrivals( pcbArray, processCount, configDataPtr );
+   
+   //EVENT LOG: All Processes init in READY, unless they arrive over time
+   if( staggeredArrivals == False )
+   {
+      accessTimer( &simContext.simTimer, LAP_TIMER, timeString );
+      eventData = generateEventData( OS, AllProcREADY, timeString,
                                     pcbArray[scheduledProcess].programCounter, 
                                                 &pcbArray[scheduledProcess] );
-   eventLogger( eventData, configDataPtr, listCurrentPtr );
+      eventData.coreId = -1;
+      eventLogger( eventData, configDataPtr, listCurrentPtr );
+   }
    
    
-   //Initialize in READY state//////////////////////////////////////////////////
-   initInReady( pcbArray, processCount );
-    
-   //Calculate each of the remaining times on each Process
-   calcRemainingTimes( pcbArray, configDataPtr, processCount );
+   //Initialize the run queue of each core, processes are admitted in READY
+   //by the cores from the arrival queue, once their arrival time has passed
+   for( indexI = 0; indexI < coreCount; indexI++ )
+   {
+      schedulerInit( &schedulers[indexI], configDataPtr, processCount );
+   }
+   eventQueueInit( &arrivalQueue, processCount + 1 );
+   for( indexI = 0; indexI < processCount; indexI++ )
+   {
+      eventQueuePush( &arrivalQueue, pcbArray[indexI].arrivalUs, 
+                                                EV_PROCESS_ARRIVAL, indexI );
+   }
    
-   //init threadManager
-   threadManager(tINIT, NULL);
+   //init threadManager, the lock our cores share, and the devices our I/O
+   //threads queue on
+   threadManager( &simContext.threadStack, tINIT, NULL );
+   pthread_mutex_init( &simContext.simMutex, NULL );
+   startUs = wallTimeUs();
+   deviceTableInit( &deviceTable, configDataPtr, startUs );
+   histogramInit( &latencyStats.opRunUs );
+   histogramInit( &latencyStats.interruptUs );
+   histogramInit( &latencyStats.decisionNs );
     
    
+   //START CORES -- each core loops for P not in EXIT //////////////////////////
+   for( indexI = 0; indexI < coreCount; indexI++ )
+   {
+      coreContexts[indexI].coreId = indexI;
+      coreContexts[indexI].simContext = &simContext;
+      coreContexts[indexI].scheduledProcess = 0;
+      coreContexts[indexI].configDataPtr = configDataPtr;
+      coreContexts[indexI].pcbArray = pcbArray;
+      coreContexts[indexI].processCount = processCount;
+      coreContexts[indexI].listCurrentPtr = listCurrentPtr;
+      coreContexts[indexI].mmuCurrentPtr = mmuCurrentPtr;
+      coreContexts[indexI].mmuHeadPtr = mmuHeadPtr;
+      coreContexts[indexI].deviceTable = &deviceTable;
+      coreContexts[indexI].interruptStats = &interruptStats;
+      coreContexts[indexI].deadlineStats = &deadlineStats;
+      coreContexts[indexI].latencyStats = &latencyStats;
+      coreContexts[indexI].arrivalQueue = &arrivalQueue;
+      coreContexts[indexI].staggeredArrivals = staggeredArrivals;
+      coreContexts[indexI].startUs = startUs;
+      coreContexts[indexI].schedulers = schedulers;
+      coreContexts[indexI].coresBusy = coresBusy;
+      coresBusy[indexI] = False;
+      coreContexts[indexI].coreStats.busyUs = 0;
+      coreContexts[indexI].coreStats.dispatches = 0;
+      coreContexts[indexI].coreStats.steals = 0;
+      coreContexts[indexI].coreStats.readyWaitUs = 0;
+      coreContexts[indexI].coreStats.maxReadyWaitUs = 0;
+      coreContexts[indexI].coreStats.contextSwitches = 0;
+      coreContexts[indexI].coreStats.switchOverheadUs = 0;
+      coreContexts[indexI].coreStats.warmupUs = 0;
+      
+      pthread_create( &coreThreads[indexI], NULL, coreRunner, 
+                                             (void*) &coreContexts[indexI] );
+   }
+   
+   //wait for every core to see all processes in EXIT
+   for( indexI = 0; indexI < coreCount; indexI++ )
+   {
+      pthread_join( coreThreads[indexI], NULL );
+      coreStats[indexI] = coreContexts[indexI].coreStats;
+   }
+   eventQueueDestruct( &arrivalQueue );
+   /////////////////////////////END CORES///////////////////////////////////////
+   
+   
+   //EVENT LOG: System Stop
+   scheduledProcess = coreContexts[0].scheduledProcess;
+   accessTimer( &simContext.simTimer, LAP_TIMER, timeString );
+   eventData = generateEventData( OS, SystemStop, timeString,
+      pcbArray[scheduledProcess].programCounter, &pcbArray[scheduledProcess] );
+   eventData.coreId = -1;
+   eventLogger( eventData, configDataPtr, listCurrentPtr );
+   traceClose( configDataPtr );
+   metricsClose( configDataPtr );
+   recordClose( &simContext.recorder );
+   
+   //report how busy and contended each I/O device and core was
+   PROFILE_BEGIN( PROF_REPORT );
+   logDeviceStats( &deviceTable, wallTimeUs(), configDataPtr, listHeadPtr );
+   logInterruptStats( &interruptStats, configDataPtr, listHeadPtr );
+   logLatencyStats( &latencyStats, &deviceTable, configDataPtr, listHeadPtr );
+   logCoreStats( coreStats, coreCount, wallTimeUs() - startUs, 
+                                                configDataPtr, listHeadPtr );
+   logSchedulingStats( pcbArray, processCount, coreStats, coreCount,
+                                                configDataPtr, listHeadPtr );
+   logOverheadStats( coreStats, coreCount, configDataPtr, listHeadPtr );
+   logDeadlineStats( &deadlineStats, configDataPtr, listHeadPtr );
+   summariseRun( &runSummary, pcbArray, processCount, coreStats, coreCount,
+                                          startUs, wallTimeUs() - startUs );
+   logPerformanceSummary( &runSummary, configDataPtr, listHeadPtr );
+   PROFILE_END( PROF_REPORT );
+
+   if( runSummaryPtr != NULL )
+   {
+      *runSummaryPtr = runSummary;
+   }
+   
+   //EXIT with normal operation
+   if( configDataPtr->logToCode != LOGTO_NONE_CODE )
+   {
+      printf("\nEnd Simulation - Complete\n");
+      printf( "==========================\n" );
+   }
+   
+   //Check if we need to save of completeLog to a file
+   configCodeToString( configDataPtr->logToCode, checkIfFile );
+   if( compareString( checkIfFile, "Both" ) == STR_EQ  
+            || compareString( checkIfFile, "File" ) == STR_EQ)
+   {
+      logToFile( listHeadPtr, configDataPtr );
+      writeSummaryFile( pcbArray, processCount, startUs );
+   }
+   PROFILE_END( PROF_RUN );
+   printProfileStats();
+   
+   //clear out our logLinkedList, and free temporary memory for newNodePtr
+   listHeadPtr = clearLinkedList( listHeadPtr );
+   free( newNodePtr );
+   
+   //clear our our MMU linkedList, and free temp memory
+   mmuHeadPtr = clearMMU( mmuHeadPtr );
+   free( mmuNewPtr );
+   
+   //clear interrupt queue
+   interruptQueue( &simContext.interruptQueue, DESTRUCT, 0, processCount );
+   
+   //clear threadmanager, the lock, the devices, and the run queues
+   threadManager( &simContext.threadStack, tDESTRUCT, NULL );
+   pthread_mutex_destroy( &simContext.simMutex );
+   deviceTableDestruct( &deviceTable );
+   for( indexI = 0; indexI < coreCount; indexI++ )
+   {
+      schedulerDestruct( &schedulers[indexI] );
+   }
+   
+   //safe return from simulationRunner
+   return 0;
+}
+
+/*
+Function name: coreRunner
+Algorithm: the main simulator loop for one CPU core. Services interrupts,
+            selects a process from the core's run queue (or steals one from
+            another core), and sends its op to operationRunner
+Precondition: valid pthread create call, with a CoreContext
+Postcondition: returns NULL once every process is in EXIT
+Exceptions: none
+Notes: the simulation lock is held throughout, except while an op waits
+       out its time or the core has nothing to run
+*/
+void* coreRunner( void* coreInput )
+{
+   //initializations///////////////////////////////////////////////////////////
+   CoreContext* core = (CoreContext*) coreInput;
+   SimContext* context = core->simContext;
+   InterruptQueue* interrupts = &context->interruptQueue;
+   ConfigDataType* configDataPtr = core->configDataPtr;
+   PCB* pcbArray = core->pcbArray;
+   int processCount = core->processCount;
+   LogLinkedList* listCurrentPtr = core->listCurrentPtr;
+   InterruptStats* interruptStats = core->interruptStats;
+   Scheduler* schedulers = core->schedulers;
+   char timeString[MAX_STR_LEN];
+   OpCodeType* currentProgramCounter;
+   int indexI = 0;
+   int scheduledProcess = 0;
+   int oldScheduledProcess = 0;
+   int segFaultFlag = 0;
+   int interruptedPid = 0;
+   int batchSize = 0;
+   int victimCore = -1;
+   int ranMs = 0;
+   int sliceMs = 0;
+   long long runStartUs = 0;
+   long long latenessUs = 0;
+   long long overheadUs = 0;
+   long long opStartUs = 0;
+   long long decisionStartNs = 0;
+   Boolean exitFlag = False;
+   Boolean switchedFlag = False;
+   Boolean idleFlag = False;
+   Boolean isFirstRun = True;
+   EventData eventData;
+   
+   simulationLock( context, True );
+   
    //MAIN SIMULATOR LOOP -- Loop for P not in EXIT /////////////////////////////
-   while( processingFlag == True )
+   while( allProcessesExited( pcbArray, processCount ) == False )
    {
+      //admit every process whose arrival time has passed
+      admitArrivals( core );
+      
       //check for interupts, if our queue is not empty, then we need to process
-      if( !interruptQueue( ISEMPTY, 0, 0 ) )
+      PROFILE_BEGIN( PROF_INTERRUPTS );
+      if( !interruptQueue( interrupts, ISEMPTY, 0, 0 ) 
+                              && interruptCoalescing( configDataPtr ) == False )
       {
          interruptedPid = -1;
-         interruptedPid = interruptQueue( DEQUEUE, 0, 0 );
+         histogramRecord( &core->latencyStats->interruptUs, 
+                              interruptQueue( interrupts, HEAD_WAIT, 0, 0 ) );
+         interruptedPid = interruptQueue( interrupts, DEQUEUE, 0, 0 );
          if( interruptedPid >= 0 )
          {
-            pcbArray[interruptedPid].pState = READY;
+            makeReady( configDataPtr, schedulers, &pcbArray[interruptedPid],
+                                                               wallTimeUs() );
+            interruptStats->serviced++;
+            interruptStats->batches++;
+            interruptStats->maxBatch = 1;
             
             //EVENT LOG: Interrupt Called by Process interruptedPid
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( OS, Interrupt, timeString,
                                     pcbArray[interruptedPid].programCounter, 
                                                 &pcbArray[interruptedPid] );
@@ -142,25 +370,64 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
          }
       }
       
-      //check if we didnt have any interrupts and we are Idle
-      else if( idleFlag == True )
+      //coalescing, hold interrupts until a batch is due then service the 
+         //whole batch in one pass
+      else if( interruptBatchDue( configDataPtr, 
+                  interruptQueue( interrupts, SIZE, 0, 0 ),
+                     interruptQueue( interrupts, HEAD_AGE, 0, 0 ) * 1000LL,
+                                                                  idleFlag ) )
       {
-         //check our threadStack, pop them off and free them.
-         pthread_t runningThread = threadManager( tFIRST, NULL );
-         threadManager( tPOP, NULL );
-         if(!runningThread)
+         batchSize = interruptQueue( interrupts, SIZE, 0, 0 );
+         interruptStats->serviced += batchSize;
+         interruptStats->batches++;
+         if( batchSize > interruptStats->maxBatch )
+         {
+            interruptStats->maxBatch = batchSize;
+         }
+         
+         //EVENT LOG: Interrupt batch of batchSize
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
+         eventData = generateEventData( OS, InterruptBatch, timeString,
+                                                                  NULL, NULL );
+         eventData.batchSize = batchSize;
+         eventLogger( eventData, configDataPtr, listCurrentPtr );
+         
+         for( indexI = 0; indexI < batchSize; indexI++ )
          {
-            free((void*)runningThread);
+            histogramRecord( &core->latencyStats->interruptUs, 
+                              interruptQueue( interrupts, HEAD_WAIT, 0, 0 ) );
+            interruptedPid = interruptQueue( interrupts, 
+                           indexI == 0 ? BATCH_DEQUEUE : DEQUEUE, 0, 0 );
+            makeReady( configDataPtr, schedulers, &pcbArray[interruptedPid],
+                                                               wallTimeUs() );
+            
+            //EVENT LOG: Interrupt Called by Process interruptedPid
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
+            eventData = generateEventData( OS, Interrupt, timeString,
+                                    pcbArray[interruptedPid].programCounter, 
+                                                &pcbArray[interruptedPid] );
+            eventLogger( eventData, configDataPtr, listCurrentPtr );
          }
       }
       
+      //check if we didnt have any interrupts and we are Idle
+      else if( idleFlag == True )
+      {
+         //check our threadStack, the threads are detached so just pop them
+         threadManager( &context->threadStack, tPOP, NULL );
+      }
+      
+      PROFILE_END( PROF_INTERRUPTS );
+      
       //check if all processes are blocked, if so SYS IDLE
       int blockCount = 0;
       idleFlag = False;
       for( indexI = 0; indexI < processCount; indexI++ )
       {
-         //using if greater than equal to BLOCKED accounts for blocked and exit
-         if( pcbArray[indexI].pState >= BLOCKED )
+         //using if greater than equal to BLOCKED accounts for blocked and exit,
+            //processes still in NEW have not arrived yet
+         if( pcbArray[indexI].pState >= BLOCKED 
+                                          || pcbArray[indexI].pState == NEW )
          {
             blockCount++;
          }
@@ -168,7 +435,7 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
          if( blockCount == processCount )
          {
             //EVENT LOG: BEGIN SYSTEM IDLE
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( OS, SystemIdle, timeString, NULL, 
                                                                         NULL);
             //eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -176,23 +443,55 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
          }
       }
       
-      //Select process, utilizing cpuScheduler
+      //Select process from our run queue, or steal one, utilizing scheduler
       oldScheduledProcess = scheduledProcess;
-      scheduledProcess = cpuScheduler( pcbArray, processCount, configDataPtr );
+      decisionStartNs = wallTimeNs();
+      PROFILE_BEGIN( PROF_SCHEDULER );
+      scheduledProcess = coreScheduler( schedulers, configDataPtr->cpuCores,
+                     pcbArray, core->coresBusy, core->coreId, &victimCore );
+      PROFILE_END( PROF_SCHEDULER );
+      histogramRecord( &core->latencyStats->decisionNs, 
+                                             wallTimeNs() - decisionStartNs );
       
-      //ensure our scheduler picked a valid process
+      //ensure our scheduler picked a valid process, otherwise give the other
+      //cores and the I/O threads a turn
       if( scheduledProcess < 0 )
       {
+         PROFILE_BEGIN( PROF_IDLE );
+         simulationLock( context, False );
+         sched_yield();
+         simulationLock( context, True );
+         PROFILE_END( PROF_IDLE );
          continue;
       }
+      metricsAdd( configDataPtr, METRIC_SCHED_DECISIONS, 1 );
+      
+      core->scheduledProcess = scheduledProcess;
+      core->coresBusy[ core->coreId ] = True;
+      markDispatched( &core->coreStats, &pcbArray[scheduledProcess],
+                                                               wallTimeUs() );
+      
+      //EVENT LOG: Process stolen from the run queue of victimCore
+      if( victimCore >= 0 )
+      {
+         core->coreStats.steals++;
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
+         eventData = generateEventData( OS, ProcStolen, timeString,
+                                    pcbArray[scheduledProcess].programCounter, 
+                                                &pcbArray[scheduledProcess] );
+         eventData.stolenFrom = victimCore;
+         eventLogger( eventData, configDataPtr, listCurrentPtr );
+      }
       
       //check if our selected process is new, otherwise ignore.
-      if( oldScheduledProcess != scheduledProcess || isFirstRun == True )
+      switchedFlag = ( oldScheduledProcess != scheduledProcess 
+                                                      || isFirstRun == True );
+      if( switchedFlag == True )
       {
          isFirstRun = False;
          
          //EVENT LOG: ProcessSelected with Remaining time: 
-         accessTimer( LAP_TIMER, timeString );
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
          eventData = generateEventData( OS, ProcSelected, timeString,
                                     pcbArray[scheduledProcess].programCounter, 
                                                 &pcbArray[scheduledProcess] );
@@ -202,33 +501,84 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
       //Set Process in RUNNING if READY
       if( pcbArray[scheduledProcess].pState == READY )
       {
-         pcbArray[scheduledProcess].pState = RUNNING;
+         setProcessState( configDataPtr, &pcbArray[scheduledProcess],
+                                                                  RUNNING );
          
          //EVENT LOG: select process and set in RUNNING
-         accessTimer( LAP_TIMER, timeString );
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
          eventData = generateEventData( OS, ProcSetIn, timeString,
                                     pcbArray[scheduledProcess].programCounter, 
                                                 &pcbArray[scheduledProcess] );
          eventLogger( eventData, configDataPtr, listCurrentPtr );
       }
       
+      //pay for the dispatch before the op runs, the core is held but the
+         //other cores carry on
+      runStartUs = wallTimeUs();
+      overheadUs = chargeDispatch( &core->coreStats, 
+                                    &pcbArray[scheduledProcess], core->coreId,
+                                                switchedFlag, configDataPtr );
+      if( overheadUs > 0 )
+      {
+         //EVENT LOG: context switch overhead
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
+         eventData = generateEventData( OS, ContextSwitch, timeString,
+                                    pcbArray[scheduledProcess].programCounter, 
+                                                &pcbArray[scheduledProcess] );
+         eventData.overheadUs = overheadUs;
+         eventLogger( eventData, configDataPtr, listCurrentPtr );
+         
+         PROFILE_BEGIN( PROF_SIM_WAIT );
+         simulationLock( context, False );
+         runTimer( (int) ( overheadUs / 1000 ) );
+         simulationLock( context, True );
+         PROFILE_END( PROF_SIM_WAIT );
+      }
+      
       //grab our PC, and send to Operation runner to handle run types
          //IE, RUN, I/O, or MEM Operations
       currentProgramCounter = pcbArray[scheduledProcess].programCounter;
+      opStartUs = wallTimeUs();
       segFaultFlag = operationRunner( scheduledProcess, currentProgramCounter, 
-                                       configDataPtr, pcbArray, listCurrentPtr, 
-                                                mmuCurrentPtr, mmuHeadPtr );
+                                 configDataPtr, pcbArray, listCurrentPtr, 
+                                    core->mmuCurrentPtr, core->mmuHeadPtr,
+                                          core->deviceTable, context );
+      if( currentProgramCounter->opLtr == 'P' )
+      {
+         histogramRecord( &core->latencyStats->opRunUs, 
+                                                   wallTimeUs() - opStartUs );
+      }
+      core->coreStats.busyUs += wallTimeUs() - runStartUs;
       
-      //after a run, reset to READY
-      if( pcbArray[scheduledProcess].pState == RUNNING )
+      //only run ops hold the CPU for any simulated time
+      ranMs = 0;
+      if( currentProgramCounter->opLtr == 'P' )
       {
-         pcbArray[scheduledProcess].pState = READY;
+         ranMs = currentProgramCounter->opValue * configDataPtr->procCycleRate;
+      }
+      exitFlag = ( currentProgramCounter->opLtr == 'A' || segFaultFlag == 1 );
+      
+      //after a run, reset to READY, back in our run queue, unless ending
+      if( pcbArray[scheduledProcess].pState == RUNNING && exitFlag == False )
+      {
+         sliceMs = schedulerTimeSlice( &schedulers[core->coreId],
+                                                &pcbArray[scheduledProcess] );
+         schedulerPreempt( &schedulers[core->coreId], 
+                           &pcbArray[scheduledProcess], ranMs,
+                                       sliceMs > 0 && ranMs >= sliceMs );
+         makeReady( configDataPtr, schedulers, &pcbArray[scheduledProcess],
+                                                               wallTimeUs() );
+      }
+      else if( pcbArray[scheduledProcess].pState == BLOCKED )
+      {
+         schedulerBlock( &schedulers[core->coreId], 
+                                       &pcbArray[scheduledProcess], ranMs );
       }
       
       if( segFaultFlag == 1)
       {
          //EVENT LOG: segfault, process experiences
-         accessTimer( LAP_TIMER, timeString );
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
          eventData = generateEventData( OS, SegFault, timeString,
                                     pcbArray[scheduledProcess].programCounter, 
                                                 &pcbArray[scheduledProcess] );
@@ -240,15 +590,33 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
       
       //CHECK FOR FINISH, since we started our program Counter with an offset 
          //from start, this will only ever be A(end)0; or Segfault exit.
-      if( currentProgramCounter->opLtr == 'A' || segFaultFlag == 1 )
+      if( exitFlag == True )
       {
          //ensure we havent already been placed in EXIT, avoid double prints
          if( pcbArray[scheduledProcess].pState != EXIT )
          {
-            pcbArray[scheduledProcess].pState = EXIT;
+            setProcessState( configDataPtr, &pcbArray[scheduledProcess],
+                                                                     EXIT );
+            pcbArray[scheduledProcess].completionUs = wallTimeUs();
+            schedulerExit( &schedulers[core->coreId], 
+                                       &pcbArray[scheduledProcess], ranMs );
+            
+            //EVENT LOG: process ended past its deadline
+            latenessUs = checkDeadline( core->deadlineStats, 
+                                       &pcbArray[scheduledProcess],
+                                             wallTimeUs() - core->startUs );
+            if( latenessUs > 0 )
+            {
+               accessTimer( &context->simTimer, LAP_TIMER, timeString );
+               eventData = generateEventData( OS, DeadlineMissed, timeString,
+                                    pcbArray[scheduledProcess].programCounter, 
+                                                &pcbArray[scheduledProcess] );
+               eventData.latenessUs = latenessUs;
+               eventLogger( eventData, configDataPtr, listCurrentPtr );
+            }
             
             //EVENT LOG: end process and set in EXIT
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( OS, ProcEnd, timeString,
                                        pcbArray[scheduledProcess].programCounter, 
                                                    &pcbArray[scheduledProcess] );
@@ -263,138 +631,260 @@ int simulationRunner(ConfigDataType* configDataPtr, OpCodeType* mdData)
          pcbArray[scheduledProcess].programCounter = 
             pcbArray[scheduledProcess].programCounter->next;
       }
-      
-      processingFlag = False;
-      //Check if all processing are in EXIT, if so we stop simulating
-      for( indexI = 0; indexI < processCount; indexI++ )
-      {
-         if( pcbArray[indexI].pState != EXIT )
-         {
-            processingFlag = True;
-         }
-      }
+      core->coresBusy[ core->coreId ] = False;
    }
    /////////////////////////////END MAIN SIM LOOP///////////////////////////////
    
+   simulationLock( context, False );
    
-   //EVENT LOG: System Stop
-   accessTimer( LAP_TIMER, timeString );
-   eventData = generateEventData( OS, SystemStop, timeString,
-      pcbArray[scheduledProcess].programCounter, &pcbArray[scheduledProcess] );
-   eventLogger( eventData, configDataPtr, listCurrentPtr );
+   return NULL;
+}
+
+/*
+Function name: simulationLock
+Algorithm:     holds the run's mutex, that guards the PCBs, the log list and
+               the MMU while the cores share them
+Precondition:  run's context with its mutex initialised, True to acquire the
+               lock, False to release it
+Postcondition: lock acquired or released
+Exceptions: none
+Notes: I/O threads never take this lock, they only touch their device and
+       the interruptQueue, which have locks of their own
+*/
+void simulationLock( SimContext* context, Boolean acquire )
+{
+   if( acquire == True )
+   {
+      pthread_mutex_lock( &context->simMutex );
+   }
+   else
+   {
+      pthread_mutex_unlock( &context->simMutex );
+   }
+}
+
+/*
+Function name: allProcessesExited
+Algorithm:     checks every PCB for the EXIT state
+Precondition:  filled pcbArray, and a count of the processes
+Postcondition: returns True once every process is in EXIT
+Exceptions: none
+Notes: none
+*/
+Boolean allProcessesExited( PCB* pcbArray, int processCount )
+{
+   int indexI;
    
+   for( indexI = 0; indexI < processCount; indexI++ )
+   {
+      if( pcbArray[indexI].pState != EXIT )
+      {
+         return False;
+      }
+   }
    
-   //EXIT with normal operation
-   printf("\nEnd Simulation - Complete\n");
-   printf( "==========================\n" );
+   return True;
+}
+
+/*
+Function name: coreScheduler
+Algorithm: picks from the core's own run queue, and when that is empty 
+            steals the process the longest other run queue would run next,
+            moving it to this core, as long as the queue's own core is busy
+            or has more than one process waiting
+Precondition: a scheduler per core, holding the READY processes, coresBusy
+              True for each core running a process
+Postcondition: returns the pId to run, or -1, victimCore set to the core
+               stolen from, or -1 if nothing was stolen
+Exceptions: none
+Notes: IMPORTANT: the policy itself lives behind the scheduler interface, see
+                  Scheduler.c, this only decides which run queue to ask.
+       caller holds the simulation lock, or is the virtual clock runner
+*/
+int coreScheduler( Scheduler* schedulers, int coreCount, PCB* pcbArray,
+                        Boolean* coresBusy, int coreId, int* victimCore )
+{
+   int scheduledPid;
+   int indexI;
    
-   //Check if we need to save of completeLog to a file
-   configCodeToString( configDataPtr->logToCode, checkIfFile );
-   if( compareString( checkIfFile, "Both" ) == STR_EQ  
-            || compareString( checkIfFile, "File" ) == STR_EQ)
+   *victimCore = -1;
+   scheduledPid = schedulerPickNext( &schedulers[ coreId ] );
+   
+   if( scheduledPid >= 0 || coreCount == 1 )
    {
-      logToFile( listHeadPtr, configDataPtr );
+      return scheduledPid;
    }
    
-   //clear out our logLinkedList, and free temporary memory for newNodePtr
-   listHeadPtr = clearLinkedList( listHeadPtr );
-   free( newNodePtr );
-   
-   //clear our our MMU linkedList, and free temp memory
-   mmuHeadPtr = clearMMU( mmuHeadPtr );
-   free( mmuNewPtr );
+   //our run queue is empty, find the busiest queue to steal from, an idle
+   //core is left its only process, it will run it itself
+   for( indexI = 0; indexI < coreCount; indexI++ )
+   {
+      if( ( schedulers[ indexI ].queueLength > 1
+               || ( schedulers[ indexI ].queueLength == 1
+                                          && coresBusy[ indexI ] == True ) )
+            && ( *victimCore == -1 || schedulers[ indexI ].queueLength 
+                                    > schedulers[ *victimCore ].queueLength ) )
+      {
+         *victimCore = indexI;
+      }
+   }
    
-   //clear interrupt queue
-   interruptQueue(DESTRUCT, 0, processCount);
+   if( *victimCore == -1 )
+   {
+      return -1;
+   }
    
-   //clear threadmanager
-   threadManager(tDESTRUCT, NULL);
+   //take the victim's next process, it now lives in our run queue
+   scheduledPid = schedulerPickNext( &schedulers[ *victimCore ] );
+   pcbArray[scheduledPid].homeCore = coreId;
    
-   //safe return from simulationRunner
-   return 0;
+   return scheduledPid;
 }
 
 /*
-Function name: cpuScheduler
-Algorithm: in this version, initial configuration for FCFS-N only
-            the scheduler takes in a list of arrays, and selects the next
-            process to be run, based on its scheduling strategy
-Precondition: filled pcbArray, and a count of the processes
-Postcondition: returns the pId of the next process to be run
+Function name: makeReady
+Algorithm: adds the time since a BLOCKED process blocked to its blocked
+            total, sets the process in READY, and enqueues it on its home core
+Precondition: a scheduler per core, process not already queued, current
+               time of the simulation clock in use
+Postcondition: process in READY, and in a run queue
 Exceptions: none
-Notes: IMPORTANT: I utilized a scheduler seperate from the interrupt features
-                  so we will not see those here, see operationRunner below for
-                  that functionality
+Notes: none
 */
-int cpuScheduler(PCB* pcbArray, int processCount, ConfigDataType* configDataPtr)
+void makeReady( ConfigDataType* configDataPtr, Scheduler* schedulers,
+                                             PCB* process, long long nowUs )
 {
-   static int rrNextPosition = -1;
-   int scheduledPid = -1;
-   int indexI = 0;
-   int shortestJobFound = 999999999;
-   int scheduleCode = configDataPtr->cpuSchedCode;
-   
-   //run until we find a pid that is scheduled
-   while( indexI < processCount )
-   {  
-      //increment our round robin position counter
-      rrNextPosition++;
-      
-      //if we hit back of array return to start
-      if( rrNextPosition == processCount )
-      {
-         rrNextPosition = 0;
-      }  
-
-      //only work on processess that are ready or running
-      if( pcbArray[indexI].pState == READY 
-            || pcbArray[indexI].pState == RUNNING )
-      {
-         //FCFS-N implementation / FCFS-P implementation,
-         //The premption will be handled in the operationRunner, which will
-         //decrement the remainingTime of processes.
-         if( ( scheduleCode == CPU_SCHED_FCFS_N_CODE || 
-                  scheduleCode == CPU_SCHED_FCFS_P_CODE )
-                                                   && scheduledPid == -1 )
-         {
-            scheduledPid = pcbArray[indexI].pId;
-         }
-         
-         //SJF-N implementation / SRTF-P implementation,
-         //The premption will be handled in the operationRunner, which will
-         //decrement the remainingTime of processes.
-         else if( scheduleCode == CPU_SCHED_SJF_N_CODE ||
-                                       scheduleCode == CPU_SCHED_SRTF_P_CODE )
-         {
-            if( pcbArray[indexI].remainingTimeMs < shortestJobFound )
-            {
-               scheduledPid = pcbArray[indexI].pId;
-               shortestJobFound = pcbArray[indexI].remainingTimeMs;
-            }
-         }
-         
-         //RR-P implementation // early return, as we do not require multiple
-         //iterations, once we found a valid process next in our counter we go
-         else if( scheduleCode == CPU_SCHED_RR_P_CODE  
-                              &&  pcbArray[rrNextPosition].pState != EXIT )
-         {
-            return rrNextPosition;
-         }
-         
-         //default to FCFS-N // still need to ensure we hadnt selected a job yet
-         else if ( scheduledPid == -1 )
-         {
-            scheduledPid = pcbArray[indexI].pId;
-         }
-      }
-      
-      indexI++;
+   if( process->pState == BLOCKED )
+   {
+      process->blockedUs += nowUs - process->blockedSinceUs;
    }
-   
-   return scheduledPid;
+
+   setProcessState( configDataPtr, process, READY );
+   process->readySinceUs = nowUs;
+   schedulerEnqueue( &schedulers[ process->homeCore ], process );
 }
 
+/*
+Function name: setProcessState
+Algorithm: moves the process to its new state, and its count on the
+            metrics socket with it
+Precondition: configDataPtr of the process's run, process created by
+               createPCBs
+Postcondition: process in pState
+Exceptions: none
+Notes: every change of state after createPCBs goes through here
+*/
+void setProcessState( ConfigDataType* configDataPtr, PCB* process,
+                                                      ProcessState pState )
+{
+   metricsAdd( configDataPtr, METRIC_PROCESSES_NEW + process->pState, -1 );
+   metricsAdd( configDataPtr, METRIC_PROCESSES_NEW + pState, 1 );
+   process->pState = pState;
+}
+
+/*
+Function name: markDispatched
+Algorithm: counts a dispatch on the core, and adds the time the process
+            waited in READY to its own and the core's ready wait totals,
+            stamping the process's first dispatch
+Precondition: process just taken from a run queue, current time of the
+               simulation clock in use
+Postcondition: dispatch and ready wait recorded
+Exceptions: none
+Notes: none
+*/
+void markDispatched( CoreStats* coreStats, PCB* process, long long nowUs )
+{
+   long long waitUs = nowUs - process->readySinceUs;
+
+   coreStats->dispatches++;
+   coreStats->readyWaitUs += waitUs;
+   if( waitUs > coreStats->maxReadyWaitUs )
+   {
+      coreStats->maxReadyWaitUs = waitUs;
+   }
 
+   process->readyWaitUs += waitUs;
+   if( process->firstDispatchUs < 0 )
+   {
+      process->firstDispatchUs = nowUs;
+   }
+}
+
+/*
+Function name: chargeDispatch
+Algorithm: adds the context switch and scheduler decision costs when the
+            core switched to a different process, and the cache warmup
+            penalty when the process last ran on another core or not at all
+Precondition: process just dispatched on coreId, switched if it is not the
+               process the core last ran
+Postcondition: returns the dispatch overhead in us, added to the core's
+               totals, process's last core set
+Exceptions: none
+Notes: costs are in processor cycles, so they scale with the cycle rate
+*/
+long long chargeDispatch( CoreStats* coreStats, PCB* process, int coreId,
+                        Boolean switched, ConfigDataType* configDataPtr )
+{
+   long long switchUs = 0;
+   long long warmupUs = 0;
+
+   if( switched == True )
+   {
+      coreStats->contextSwitches++;
+      switchUs = ( configDataPtr->switchCostCycles
+                     + configDataPtr->decisionCostCycles )
+                              * configDataPtr->procCycleRate * 1000LL;
+   }
+
+   if( process->lastCore != coreId )
+   {
+      warmupUs = configDataPtr->warmupCostCycles
+                              * configDataPtr->procCycleRate * 1000LL;
+   }
+
+   process->lastCore = coreId;
+   coreStats->switchOverheadUs += switchUs;
+   coreStats->warmupUs += warmupUs;
+
+   return switchUs + warmupUs;
+}
+
+/*
+Function name: checkDeadline
+Algorithm: compares the time a process ended with its deadline, and adds it
+            to the deadline totals
+Precondition: process has just ended, elapsedUs since the run started
+Postcondition: returns how late the process ended in us, 0 if it met its
+               deadline or has none
+Exceptions: none
+Notes: none
+*/
+long long checkDeadline( DeadlineStats* deadlineStats, PCB* process,
+                                                         long long elapsedUs )
+{
+   long long latenessUs = elapsedUs - process->deadlineUs;
+   
+   if( process->deadlineUs < 0 )
+   {
+      return 0;
+   }
+   
+   deadlineStats->deadlines++;
+   if( latenessUs <= 0 )
+   {
+      return 0;
+   }
+   
+   deadlineStats->missed++;
+   deadlineStats->totalLatenessUs += latenessUs;
+   if( latenessUs > deadlineStats->maxLatenessUs )
+   {
+      deadlineStats->maxLatenessUs = latenessUs;
+   }
+   
+   return latenessUs;
+}
 
 /*
 Function name: operationRunner
@@ -402,7 +892,7 @@ Algorithm: utilizes process information to "perform" the operations of a process
             uniquely operates based on operation type. Sends off to the
             eventLogger at each step.
 Precondition: schedulePid, and process information, linked list for sending to
-               logger, and linked list of the MMU
+               logger, linked list of the MMU, and the run's context
 Postcondition: returns when operation has been completed
 Exceptions: none
 Notes: none
@@ -412,36 +902,36 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
                                              PCB* pcbArray,
                                                 LogLinkedList* listCurrentPtr,
                                                    MMU* mmuCurrentPtr,
-                                                      MMU* mmuHeadPtr )
+                                                      MMU* mmuHeadPtr,
+                                                   DeviceTable* deviceTable,
+                                                   SimContext* context )
 {
    //initializations
    char timeString[MAX_STR_LEN];
-   char memoryValueStr[MAX_STR_LEN];
-   int intConvert = 0;
-   int ssCount = 2;
-   int ssInt = 0;
-   int bbbInt = 0;
-   int aaaInt = 0;
    int timeToWaitMs = 0;
    int segFaultFlag = 0;
-   int tempLCode = 0;
    EventData eventData;
    
    //RUN OPERATIONS
    if( programCounter->opLtr == 'P' )
    { 
       //EVENT LOG: run start
-      accessTimer( LAP_TIMER, timeString );
+      accessTimer( &context->simTimer, LAP_TIMER, timeString );
       eventData = generateEventData( Process, ProcOpStart, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
       eventLogger( eventData, configDataPtr, listCurrentPtr );
       
       //Wait out our time
+      //other cores carry on while this one waits
       timeToWaitMs = programCounter->opValue * configDataPtr->procCycleRate;
+      PROFILE_BEGIN( PROF_SIM_WAIT );
+      simulationLock( context, False );
       runTimer( timeToWaitMs );
+      simulationLock( context, True );
+      PROFILE_END( PROF_SIM_WAIT );
    
       //EVENT LOG: run end
-      accessTimer( LAP_TIMER, timeString );
+      accessTimer( &context->simTimer, LAP_TIMER, timeString );
       eventData = generateEventData(Process, ProcOpEnd, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
       eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -450,51 +940,16 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
    //MEMORY OPERATIONS
    else if( programCounter->opLtr == 'M' )
    {   
-      //parse out our memory val in SSBBBAAA format, then break into 3 seperate
-      //integers to pass along to MMU functions
-   
-      //acommodate for leading zero in SS, if so we modify the ssCount
-      if( programCounter->opValue < 10000000 )
-         ssCount = 1;
-      
-      //throw opValue into buffer and convert into string then loop through
-      //to parse out SS, BBB, and AAA ints.
-      sprintf( memoryValueStr, "%d", programCounter->opValue);
-      for( int index = 0; memoryValueStr[index] != '\0'; index++)
-      {
-         //formula to convert chars into ints based on ASCII value - char 0
-         intConvert = intConvert * 10 + ( memoryValueStr[index] - '0' );
-         
-         //find our SS / BBB / AAA offset ends with our count and +3 / +6
-         if( index+1 == ssCount )
-         {
-            ssInt = intConvert;
-            intConvert = 0;
-         }
-         
-         if( index+1 == ssCount + 3 )
-         {
-            bbbInt = intConvert;
-            intConvert = 0;
-         }
-         
-         if( index+1 == ssCount + 6 )
-         {
-            aaaInt = intConvert;
-            intConvert = 0;
-         }
-   
-      }
-      
-      //fill our data that we just calced
-      MMU mmuData = fillMMU( scheduledProcess, ssInt, bbbInt, aaaInt );
+      //parse out our memory val in SSBBBAAA format, and fill our MMU data
+      MMU mmuData = getMemoryRequest( scheduledProcess, 
+                                                   programCounter->opValue );
       pcbArray[scheduledProcess].mmuInfo = mmuData;
       
       //Check memory action type (allocate, access) and call to appropriate func 
       if( compareString( programCounter->opName, "allocate" ) == STR_EQ )
       {
          //EVENT LOG: mem attempt to allocate
-         accessTimer( LAP_TIMER, timeString );
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
          eventData = generateEventData( Process, MMUAllocAttempt, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
          eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -504,7 +959,7 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
          if( segFaultFlag == 0 )
          {
             //EVENT LOG: mem allocate success
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( Process, MMUAllocSuccess, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
             eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -512,7 +967,7 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
          else
          {
             //EVENT LOG: mem allocate failed
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( Process, MMUAllocFailed, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
             eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -526,7 +981,7 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
       else
       {
          //EVENT LOG: mem attempt to access
-         accessTimer( LAP_TIMER, timeString );
+         accessTimer( &context->simTimer, LAP_TIMER, timeString );
          eventData = generateEventData( Process, MMUAccessAttempt, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
          eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -537,7 +992,7 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
          if( segFaultFlag == 0 )
          {
             //EVENT LOG: mem access success
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( Process, MMUAccessSuccess, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
             eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -545,7 +1000,7 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
          else
          {
             //EVENT LOG: mem acess failed
-            accessTimer( LAP_TIMER, timeString );
+            accessTimer( &context->simTimer, LAP_TIMER, timeString );
             eventData = generateEventData( Process, MMUAccessFailed, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
             eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -561,7 +1016,7 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
             || programCounter->opLtr == 'O')
    {
       //EVENT LOG: io start
-      accessTimer( LAP_TIMER, timeString );
+      accessTimer( &context->simTimer, LAP_TIMER, timeString );
       eventData = generateEventData( Process, ProcOpStart, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
       eventLogger( eventData, configDataPtr, listCurrentPtr );
@@ -574,27 +1029,37 @@ int operationRunner( int scheduledProcess,OpCodeType* programCounter,
       threadInput->timeToWait = timeToWaitMs;
       threadInput->pId = scheduledProcess;
       
+      //the thread waits its turn on the device named by the op
+      threadInput->ioRequest = createIORequest( scheduledProcess,
+                  getDeviceCode( programCounter->opName ),
+                  getDiskCylinder( scheduledProcess, 
+                                    pcbArray[scheduledProcess].ioCount++,
+                                          configDataPtr->diskCylinders ),
+                                                   0, timeToWaitMs * 1000LL );
+      threadInput->device = 
+               &deviceTable->devices[ threadInput->ioRequest->deviceCode ];
+      threadInput->interruptQueue = &context->interruptQueue;
+      
       
       //use thread manager to push a new thread onto the stack
-      threadManager( tPUSH, threadInput );
+      threadManager( &context->threadStack, tPUSH, threadInput );
       
       //place our process in blocked, interruptQueue pop will handle unblocking
-      pcbArray[scheduledProcess].pState = BLOCKED;
+      setProcessState( configDataPtr, &pcbArray[scheduledProcess],
+                                                                  BLOCKED );
+      pcbArray[scheduledProcess].blockedSinceUs = wallTimeUs();
    
       //EVENT LOG: Process set in BLOCKED
-      accessTimer( LAP_TIMER, timeString );
+      accessTimer( &context->simTimer, LAP_TIMER, timeString );
       eventData = generateEventData( OS, ProcBlocked, timeString,
                                  programCounter, &pcbArray[scheduledProcess] );
       eventLogger( eventData, configDataPtr, listCurrentPtr );
       
    }
    
-   //hold a copy of the sched code, for ease of use in next if statement
-   tempLCode = configDataPtr->cpuSchedCode;
-   
-   //check if we had timeRemoved, and if we are in a PRE-EMPTIVE Code
-   if( timeToWaitMs > 0   && tempLCode >= CPU_SCHED_SRTF_P_CODE 
-                          && tempLCode <= CPU_SCHED_RR_P_CODE )
+   //check if we had timeRemoved, and if we are in a PRE-EMPTIVE policy
+   if( timeToWaitMs > 0 && getSchedulerPolicy( 
+                        configDataPtr->cpuSchedCode )->preemptive == True )
    {
       pcbArray[scheduledProcess].remainingTimeMs -= timeToWaitMs;
       
@@ -616,7 +1081,7 @@ Algorithm: allows operationRunner to send I/O on POSIX threads
 Precondition: valid pthread create call
 Postcondition: returns NULL to meet pthread_create contract
 Exceptions: none
-Notes: none
+Notes: the thread is held in its device queue while the device is busy
 */
 void* threadRunTimer( void* threadInput )
 {
@@ -624,11 +1089,26 @@ void* threadRunTimer( void* threadInput )
    int timeToWaitMs = (int) (((ThreadInput*)threadInput) -> timeToWait);
    int processId = (int) (((ThreadInput*)threadInput) -> pId);
    
+   IORequest* ioRequest = ((ThreadInput*)threadInput) -> ioRequest;
+   Device* device = ((ThreadInput*)threadInput) -> device;
+   InterruptQueue* interrupts = ((ThreadInput*)threadInput) -> interruptQueue;
+   metricsAdd( interrupts->configDataPtr, METRIC_IO_IN_FLIGHT, 1 );
+   
+   //queue on the device until one of its channels is ours, the hard drive
+   //adds the seek to its new head position to our service time
+   deviceAcquire( device, ioRequest );
+   timeToWaitMs = (int) ( ( ioRequest->serviceUs + 500 ) / 1000 );
+   
    //deference the pointer and send off the run timer
    runTimer( timeToWaitMs );
    
+   //hand the channel on to the next request waiting on the device
+   deviceRelease( device, ioRequest );
+   free( ioRequest );
+   
    //add to our interrupt queue when finished
-   interruptQueue(ENQUEUE, processId, -1);
+   interruptQueue( interrupts, ENQUEUE, processId, -1 );
+   metricsAdd( interrupts->configDataPtr, METRIC_IO_IN_FLIGHT, -1 );
    
    //free our allocated space
    free(threadInput);
@@ -638,19 +1118,18 @@ void* threadRunTimer( void* threadInput )
 
 /*
 Function name: threadManager
-Algorithm:     holds a staticn stack of threads, such that operations can be
+Algorithm:     keeps the run's stack of threads, such that operations can be
                passed into it using a action enumeration
-Precondition:  valid action call, previous INIT call
+Precondition:  valid action call, previous INIT call on the same stack
 Postcondition: returns a pthread_t structure depending on operation
 Exceptions: none
 Notes: ENSURE we call destruct on final pointers
 */
-pthread_t threadManager(ThreadAction action, ThreadInput* threadInput)
+pthread_t threadManager( ThreadStack* threadStack, ThreadAction action,
+                                                ThreadInput* threadInput )
 {
    //inits
-   static pthread_t* threads;
-   static int currentOffset;
-   int maxCap = 100;
+   int initialCap = 100;
    pthread_t toReturn;
    pthread_t newThread;
    
@@ -661,59 +1140,55 @@ pthread_t threadManager(ThreadAction action, ThreadInput* threadInput)
    {
       //initialization of stack, allocat space and point to front of it
       case tINIT:
-         threads = (pthread_t*) malloc( sizeof(pthread_t) * maxCap );
-         currentOffset = 0;
+         threadStack->threads = (pthread_t*) malloc( sizeof(pthread_t) 
+                                                               * initialCap );
+         threadStack->maxCap = initialCap;
+         threadStack->currentOffset = 0;
          break;
       
       //pushing an element into our stack, place pId inside and move offset
       case tPUSH:
-         if( currentOffset < maxCap )
-         {  
-            pthread_create( &newThread, NULL, threadRunTimer, 
-                                                         (void*) threadInput );
-            pthread_detach(newThread);
-            *(threads + currentOffset) = newThread;
-            currentOffset++;
-         }
-         else
+         //double the stack when it is full, a run can start any number
+         //of I/O threads
+         if( threadStack->currentOffset == threadStack->maxCap )
          {
-            printf("\n\nDEBUG-------> QUEUE FULL");
+            threadStack->maxCap *= 2;
+            threadStack->threads = (pthread_t*) realloc( threadStack->threads,
+                                 sizeof(pthread_t) * threadStack->maxCap );
          }
+
+         pthread_create( &newThread, NULL, threadRunTimer, 
+                                                      (void*) threadInput );
+         pthread_detach(newThread);
+         *(threadStack->threads + threadStack->currentOffset) = newThread;
+         threadStack->currentOffset++;
          break;
       
       //popping an element off the stack
       case tPOP:
          //ensure we dont overshoot our allocated memory
-         if( currentOffset == maxCap )
+         if( threadStack->currentOffset == threadStack->maxCap )
          {
-            currentOffset--;
+            threadStack->currentOffset--;
          }
 
-         if( currentOffset >= 0 && currentOffset < maxCap )
-         {  
-            toReturn = *(threads + currentOffset);
-            
-            //check that we arent at left end of queue, if not then decrement.
-            if( currentOffset != 0 )
-            {
-               currentOffset--;
-            }
-            return toReturn;
-         }
-         else
+         toReturn = *(threadStack->threads + threadStack->currentOffset);
+         
+         //check that we arent at left end of queue, if not then decrement.
+         if( threadStack->currentOffset != 0 )
          {
-            printf("DEBUG------> INTERRUPT QUEUE EMPTY");
+            threadStack->currentOffset--;
          }
-         break;
+         return toReturn;
          
       //"Destruct" our intterupt stack, free memory   
       case tDESTRUCT:
-         free( threads );
+         free( threadStack->threads );
          break;
       
       //returns element on bottom of stack
       case tFIRST:
-         toReturn = *(threads + 0);
+         toReturn = *(threadStack->threads + 0);
          return toReturn;
    }
    
@@ -723,105 +1198,198 @@ pthread_t threadManager(ThreadAction action, ThreadInput* threadInput)
 
 /*
 Function name: interruptQueue
-Algorithm:     handles a queue system for interrupts, uses static data to allow
-               calls to modify its contents, across the runtime of sim
-Precondition:  an INIT queue action call
+Algorithm:     handles a queue system for interrupts, the run's queue is
+               passed in so calls modify its contents, across the runtime of
+               sim
+Precondition:  an INIT queue action call on the same queue
 Postcondition: updates the state of the QUEUE based on actions given
 Exceptions: none
-Notes: none
+Notes: I/O threads enqueue while the main loop dequeues, so every action is
+       taken under the queue lock. HEAD_AGE returns how long, in ms, the
+       oldest interrupt has been waiting to be serviced, HEAD_WAIT the same
+       in us. Once the run gives the queue a recorder, every enqueue and
+       dequeue is recorded under the lock, so in queue order
 */
-int interruptQueue(InterruptAction action, int pId, int processNum)
+int interruptQueue( InterruptQueue* interrupts, InterruptAction action,
+                                                      int pId, int processNum )
 {
-   //static data to persist across runtime, allows us not to have to pass ptrs.
-   static int* queue;
-   static int size, headOffset, rearOffset, maxCap;
-   int toReturn = -1;
+   int toReturn = 0;
+   
+   //the lock is made with the queue, and lives until its DESTRUCT
+   if( action == INIT )
+   {
+      pthread_mutex_init( &interrupts->queueLock, NULL );
+   }
+   
+   pthread_mutex_lock( &interrupts->queueLock );
    
    //check our requested action againts our enumerator possible values
    switch( action )
    {
       //initialization of queue, allocat space and point to front of it
       case INIT:
-         maxCap = processNum;
-         queue = (int*) malloc( sizeof(int) * maxCap );
-         headOffset = 0;
-         size = 0;
-         rearOffset = maxCap - 1;
+         interrupts->maxCap = processNum;
+         interrupts->queue = (int*) malloc( sizeof(int) * processNum );
+         interrupts->raisedUs = (long long*) malloc( sizeof(long long) 
+                                                               * processNum );
+         interrupts->headOffset = 0;
+         interrupts->size = 0;
+         interrupts->rearOffset = processNum - 1;
+         interrupts->recorder = NULL;
+         interrupts->configDataPtr = NULL;
          break;
       
       //adding an element into our queue, place pId inside and move offset
       case ENQUEUE:
-         if( interruptQueue( ISFULL, 0, 0 ) )
+         if( interrupts->size == interrupts->maxCap )
          {
-            return -1;
+            toReturn = -1;
          }
          else
          {
-            rearOffset = (rearOffset + 1) % maxCap; 
-            *(queue + rearOffset) = pId;
-            size++;
+            interrupts->rearOffset = 
+                     (interrupts->rearOffset + 1) % interrupts->maxCap; 
+            *(interrupts->queue + interrupts->rearOffset) = pId;
+            *(interrupts->raisedUs + interrupts->rearOffset) = wallTimeUs();
+            interrupts->size++;
+            metricsSet( interrupts->configDataPtr, METRIC_INTERRUPT_QUEUE,
+                                                         interrupts->size );
+            recordInterrupt( interrupts->recorder, RECORD_ENQUEUE, pId,
+                        *(interrupts->raisedUs + interrupts->rearOffset) );
          }
          break;
       
-      //removing an element off the queue
+      //removing an element off the queue, a batch dequeue is the first of
+      //a coalesced batch and differs only in how it is recorded
       case DEQUEUE:
-         if( interruptQueue( ISEMPTY, 0, 0 ) )
+      case BATCH_DEQUEUE:
+         if( interrupts->size == 0 )
          {
-            return -1;
+            toReturn = -1;
          }
          else
          {
-            toReturn = *(queue + headOffset);
-            headOffset = (headOffset + 1) % maxCap;
-            size--;
-            
-            return toReturn;
+            toReturn = *(interrupts->queue + interrupts->headOffset);
+            interrupts->headOffset = 
+                     (interrupts->headOffset + 1) % interrupts->maxCap;
+            interrupts->size--;
+            metricsSet( interrupts->configDataPtr, METRIC_INTERRUPT_QUEUE,
+                                                         interrupts->size );
+            recordInterrupt( interrupts->recorder, 
+                  action == DEQUEUE ? RECORD_DEQUEUE : RECORD_BATCH,
+                                                   toReturn, wallTimeUs() );
          }
          break;
-         break;
       
       //return element at the headOffset
       case HEAD:
-         if( interruptQueue( ISEMPTY, 0, 0 ))
-         {
-            return -1;
-         }
-         else
-         {
-            return *(queue + headOffset);
-         }
+         toReturn = ( interrupts->size == 0 ) ? -1 
+                              : *(interrupts->queue + interrupts->headOffset);
          break;
       
       //return element at the rearOffset
       case REAR:
-         if( interruptQueue( ISEMPTY, 0, 0 ))
-         {
-            return -1;
-         }
-         else
-         {
-            return *(queue + rearOffset);
-         }
+         toReturn = ( interrupts->size == 0 ) ? -1 
+                              : *(interrupts->queue + interrupts->rearOffset);
          break;
          
       //"Destruct" our intterupt array, free memory   
       case DESTRUCT:
-         free( queue );
+         free( interrupts->queue );
+         free( interrupts->raisedUs );
          break;
       
       //returns true for size 0 and false otherwise
       case ISEMPTY:
-         return ( size == 0 );
+         toReturn = ( interrupts->size == 0 );
          break;
       
       //return true for size == maxCap, false otherwise
       case ISFULL:
-         return ( size == maxCap );
+         toReturn = ( interrupts->size == interrupts->maxCap );
+         break;
+      
+      //return the number of interrupts waiting
+      case SIZE:
+         toReturn = interrupts->size;
+         break;
+      
+      //return ms the headOffset interrupt has waited, 0 if none waiting
+      case HEAD_AGE:
+         if( interrupts->size > 0 )
+         {
+            toReturn = (int) ( ( wallTimeUs() 
+                  - *(interrupts->raisedUs + interrupts->headOffset) ) / 1000 );
+         }
          break;
+      
+      //return us the headOffset interrupt has waited, 0 if none waiting
+      case HEAD_WAIT:
+         if( interrupts->size > 0 )
+         {
+            toReturn = (int) ( wallTimeUs() 
+                        - *(interrupts->raisedUs + interrupts->headOffset) );
+         }
+         break;
+   }
+   
+   pthread_mutex_unlock( &interrupts->queueLock );
+   
+   if( action == DESTRUCT )
+   {
+      pthread_mutex_destroy( &interrupts->queueLock );
    }
    
    //safe exit
-   return 0;
+   return toReturn;
+}
+
+/*
+Function name: interruptCoalescing
+Algorithm:     checks the config for a batch size above one or a window
+Precondition:  loaded config data
+Postcondition: returns True if interrupts are serviced in batches
+Exceptions: none
+Notes: with the defaults every interrupt is serviced on its own
+*/
+Boolean interruptCoalescing( ConfigDataType* configDataPtr )
+{
+   return ( configDataPtr->intCoalesceCount > 1 
+                           || configDataPtr->intCoalesceWindowMs > 0 );
+}
+
+/*
+Function name: interruptBatchDue
+Algorithm:     a batch is due once enough interrupts are pending, or once the
+               oldest has waited out the window, a count of one leaves the 
+               window alone to decide. Without a window the batch is also
+               due when the CPU has nothing else to run
+Precondition:  pending count, and how long the oldest has waited
+Postcondition: returns True if pending interrupts should be serviced now
+Exceptions: none
+Notes: an idle CPU with a window still waits for it, as a device timer would
+*/
+Boolean interruptBatchDue( ConfigDataType* configDataPtr, int pendingCount,
+                                       long long pendingAgeUs, Boolean idle )
+{
+   if( pendingCount <= 0 )
+   {
+      return False;
+   }
+   
+   //a count of one leaves the window alone to decide
+   if( configDataPtr->intCoalesceCount > 1 
+                        && pendingCount >= configDataPtr->intCoalesceCount )
+   {
+      return True;
+   }
+   
+   if( configDataPtr->intCoalesceWindowMs > 0 )
+   {
+      return ( pendingAgeUs >= configDataPtr->intCoalesceWindowMs * 1000LL );
+   }
+   
+   return idle;
 }
 
 /*
@@ -878,6 +1446,25 @@ void createPCBs( PCB* pcbArray, OpCodeType* loopMetaDataPtr, int processCount )
    {
       pcbArray[indexI].pState = NEW;
       pcbArray[indexI].pId = indexI;
+      pcbArray[indexI].opRemainingMs = 0;
+      pcbArray[indexI].ioCount = 0;
+      pcbArray[indexI].homeCore = 0;
+      pcbArray[indexI].sliceMs = 0;
+      pcbArray[indexI].weight = SCHED_DEFAULT_WEIGHT;
+      pcbArray[indexI].vruntimeUs = 0;
+      pcbArray[indexI].cpuMs = 0;
+      pcbArray[indexI].readySinceUs = 0;
+      pcbArray[indexI].readyWaitUs = 0;
+      pcbArray[indexI].deadlineUs = -1;
+      pcbArray[indexI].arrivalUs = -1;
+      pcbArray[indexI].firstDispatchUs = -1;
+      pcbArray[indexI].completionUs = -1;
+      pcbArray[indexI].blockedSinceUs = 0;
+      pcbArray[indexI].blockedUs = 0;
+      pcbArray[indexI].arrivalRank = indexI;
+      pcbArray[indexI].lastCore = -1;
+      pcbArray[indexI].ioRequest = NULL;
+      pcbArray[indexI].mmuInfo = fillMMU( indexI, -1, -1, -1 );
       
       foundProcessFlag = False;
       
@@ -893,26 +1480,240 @@ void createPCBs( PCB* pcbArray, OpCodeType* loopMetaDataPtr, int processCount )
          loopMetaDataPtr = loopMetaDataPtr->next;
       }
       
+      loopMetaDataPtr = readProcessAttributes( &pcbArray[indexI], 
+                                                            loopMetaDataPtr );
       pcbArray[indexI].programCounter = loopMetaDataPtr;
    }
 }
 
 /*
-Function name: initInReady
-Algorithm:     simple function to iterate across processes and set them in Ready
-Precondition:  correctly filled pcbArray
-Postcondition: modifies state of processes in pcbArray to ready
+Function name: readProcessAttributes
+Algorithm:     reads the attribute ops that may follow a process's A(start)0,
+               A(tickets)N sets its share weight, A(deadline)N its deadline
+               in ms from its arrival, A(arrival)N its arrival in ms from the
+               start of the run, and steps past them
+Precondition:  op following the process's A(start)0
+Postcondition: returns the first op the process will run
+Exceptions: none
+Notes: attribute ops take no time, so the runners never see them
+*/
+OpCodeType* readProcessAttributes( PCB* process, OpCodeType* opCode )
+{
+   while( opCode->opLtr == 'A'
+            && compareString( opCode->opName, "start" ) != STR_EQ
+               && compareString( opCode->opName, "end" ) != STR_EQ )
+   {
+      if( compareString( opCode->opName, "tickets" ) == STR_EQ
+                                                      && opCode->opValue > 0 )
+      {
+         process->weight = opCode->opValue;
+      }
+      
+      else if( compareString( opCode->opName, "deadline" ) == STR_EQ )
+      {
+         process->deadlineUs = opCode->opValue * 1000LL;
+      }
+      
+      else if( compareString( opCode->opName, "arrival" ) == STR_EQ )
+      {
+         process->arrivalUs = opCode->opValue * 1000LL;
+      }
+      
+      opCode = opCode->next;
+   }
+   
+   return opCode;
+}
+
+/*
+Function name: assignArrivals
+Algorithm:     gives every process without an A(arrival)N op its arrival 
+               time, the next arrival of a Poisson process when an arrival
+               rate is configured, otherwise time zero. Deadlines are then 
+               moved from relative to the arrival, to absolute
+Precondition:  PCBs created, with their attribute ops read
+Postcondition: every process has an arrival time, and its rank in arrival
+               order, returns True if any process arrives after time zero
+Exceptions: none
+Notes: gaps between arrivals are exponential, with a mean of one second over
+       the rate, drawn in pId order from the configured random seed
+*/
+Boolean assignArrivals( PCB* pcbArray, int processCount, 
+                                          ConfigDataType* configDataPtr )
+{
+   unsigned long long randomState = seedRandom( configDataPtr->randomSeed );
+   long long poissonUs = 0;
+   Boolean staggeredFlag = False;
+   Boolean sortedFlag = True;
+   int indexI = 0;
+   PCB** arrivalOrder;
+   
+   for( indexI = 0; indexI < processCount; indexI++ )
+   {
+      if( pcbArray[indexI].arrivalUs < 0 )
+      {
+         pcbArray[indexI].arrivalUs = 0;
+         if( configDataPtr->arrivalRate > 0 )
+         {
+            poissonUs += (long long) ( -log( 1.0 - nextRandomUnit( 
+                              &randomState ) ) * 1000000.0 
+                                             / configDataPtr->arrivalRate );
+            pcbArray[indexI].arrivalUs = poissonUs;
+         }
+      }
+      
+      if( pcbArray[indexI].deadlineUs >= 0 )
+      {
+         pcbArray[indexI].deadlineUs += pcbArray[indexI].arrivalUs;
+      }
+      
+      if( pcbArray[indexI].arrivalUs > 0 )
+      {
+         staggeredFlag = True;
+      }
+      
+      if( indexI > 0 
+            && pcbArray[indexI].arrivalUs < pcbArray[indexI - 1].arrivalUs )
+      {
+         sortedFlag = False;
+      }
+   }
+   
+   //ranks default to pId order, only re-rank when arrival ops break it
+   if( sortedFlag == False )
+   {
+      arrivalOrder = (PCB**) malloc( sizeof( PCB* ) * processCount );
+      for( indexI = 0; indexI < processCount; indexI++ )
+      {
+         arrivalOrder[indexI] = &pcbArray[indexI];
+      }
+      
+      qsort( arrivalOrder, processCount, sizeof( PCB* ), compareArrivals );
+      for( indexI = 0; indexI < processCount; indexI++ )
+      {
+         arrivalOrder[indexI]->arrivalRank = indexI;
+      }
+      
+      free( arrivalOrder );
+   }
+   
+   return staggeredFlag;
+}
+
+/*
+Function name: compareArrivals
+Algorithm:     qsort comparison of two PCB pointers, by arrival time then pId
+Precondition:  pointers to PCB pointers
+Postcondition: returns negative, zero or positive as the first arrives
+               before, with, or after the second
+Exceptions: none
+Notes: none
+*/
+int compareArrivals( const void* first, const void* second )
+{
+   const PCB* firstPcb = *(PCB* const*) first;
+   const PCB* secondPcb = *(PCB* const*) second;
+   
+   if( firstPcb->arrivalUs != secondPcb->arrivalUs )
+   {
+      return firstPcb->arrivalUs < secondPcb->arrivalUs ? -1 : 1;
+   }
+   
+   return firstPcb->pId - secondPcb->pId;
+}
+
+/*
+Function name: admitArrivals
+Algorithm:     moves every process whose arrival time has passed from NEW to
+               READY, logging each one when processes arrive over time
+Precondition:  simulation lock held, arrival queue ordered by arrival time
+Postcondition: arrived processes are in their home core's run queue
+Exceptions: none
+Notes: none
+*/
+void admitArrivals( CoreContext* core )
+{
+   char timeString[MAX_STR_LEN];
+   EventData eventData;
+   PCB* process;
+   
+   while( eventQueueIsEmpty( core->arrivalQueue ) == False
+            && eventQueuePeek( core->arrivalQueue ).timeUs 
+                                          <= wallTimeUs() - core->startUs )
+   {
+      process = &core->pcbArray[ eventQueuePop( core->arrivalQueue ).pId ];
+      makeReady( core->configDataPtr, core->schedulers, process,
+                                                               wallTimeUs() );
+      
+      //EVENT LOG: Process arrived and set in READY
+      if( core->staggeredArrivals == True )
+      {
+         accessTimer( &core->simContext->simTimer, LAP_TIMER, timeString );
+         eventData = generateEventData( OS, ProcArrived, timeString,
+                                             process->programCounter, process );
+         eventLogger( eventData, core->configDataPtr, core->listCurrentPtr );
+      }
+   }
+}
+
+/*
+Function name: seedRandom
+Algorithm:     spreads a config seed into a non-zero generator state
+Precondition:  seed from the config
+Postcondition: returns the first generator state
+Exceptions: none
+Notes: none
+*/
+unsigned long long seedRandom( int seed )
+{
+   return (unsigned long long) seed * 2654435761ULL + 1;
+}
+
+/*
+Function name: nextRandom
+Algorithm:     xorshift64* step
+Precondition:  non-zero state from seedRandom
+Postcondition: state advanced, returns the next random value
 Exceptions: none
 Notes: none
 */
-void initInReady( PCB* pcbArray, int processCount )
+unsigned long long nextRandom( unsigned long long* randomState )
+{
+   *randomState ^= *randomState >> 12;
+   *randomState ^= *randomState << 25;
+   *randomState ^= *randomState >> 27;
+   
+   return *randomState * 2685821657736338717ULL;
+}
+
+/*
+Function name: nextRandomUnit
+Algorithm:     scales the top 53 bits of the next random value into [0, 1)
+Precondition:  non-zero state from seedRandom
+Postcondition: state advanced, returns the next random fraction
+Exceptions: none
+Notes: none
+*/
+double nextRandomUnit( unsigned long long* randomState )
+{
+   return ( nextRandom( randomState ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+
+/*
+Function name: assignCores
+Algorithm:     deals the processes out to the run queues of the cores in turn
+Precondition:  correctly filled pcbArray, at least one core
+Postcondition: every process has a home core
+Exceptions: none
+Notes: work stealing may move a process to another core later on
+*/
+void assignCores( PCB* pcbArray, int processCount, int coreCount )
 {
    int indexI = 0;
    
-   //iterate across processes and set their states to ready
    for( indexI = 0; indexI < processCount; indexI++ )
    {
-      pcbArray[indexI].pState = READY;
+      pcbArray[indexI].homeCore = indexI % coreCount;
    }
 }
 
@@ -973,5 +1774,55 @@ void calcRemainingTimes( PCB* pcbArray, ConfigDataType* configDataPtr,
    }
 }
 
-
-
+/*
+Function name: getMemoryRequest
+Algorithm:     parses a memory op value in SSBBBAAA format into its segment,
+               base and offset, and fills an MMU struct with them
+Precondition:  opValue from a valid M(allocate) or M(access) op
+Postcondition: returns the filled MMU data for the requesting process
+Exceptions: none
+Notes: SS may have a leading zero, which the integer value drops
+*/
+MMU getMemoryRequest( int pId, int opValue )
+{
+   char memoryValueStr[MAX_STR_LEN];
+   int intConvert = 0;
+   int ssCount = 2;
+   int ssInt = 0;
+   int bbbInt = 0;
+   int aaaInt = 0;
+   
+   //acommodate for leading zero in SS, if so we modify the ssCount
+   if( opValue < 10000000 )
+      ssCount = 1;
+   
+   //throw opValue into buffer and convert into string then loop through
+   //to parse out SS, BBB, and AAA ints.
+   sprintf( memoryValueStr, "%d", opValue );
+   for( int index = 0; memoryValueStr[index] != '\0'; index++)
+   {
+      //formula to convert chars into ints based on ASCII value - char 0
+      intConvert = intConvert * 10 + ( memoryValueStr[index] - '0' );
+      
+      //find our SS / BBB / AAA offset ends with our count and +3 / +6
+      if( index+1 == ssCount )
+      {
+         ssInt = intConvert;
+         intConvert = 0;
+      }
+      
+      if( index+1 == ssCount + 3 )
+      {
+         bbbInt = intConvert;
+         intConvert = 0;
+      }
+      
+      if( index+1 == ssCount + 6 )
+      {
+         aaaInt = intConvert;
+         intConvert = 0;
+      }
+   }
+   
+   return fillMMU( pId, ssInt, bbbInt, aaaInt );
+}
@@ -20,9 +20,18 @@
 #include "ConfigAccess.h"
 #include "MetaDataAccess.h"
 #include "MemoryManagementUnit.h"
+#include "EventQueue.h"
+#include "DeviceManager.h"
+#include "Scheduler.h"
+#include "Histogram.h"
+#include "Profiler.h"
+#include "Metrics.h"
 #include "simtimer.h"
 #include "StringUtils.h"
 
+//the full log, and the per process summary written next to it
+#define LOG_FILE_NAME "SimulatorLogFile.lgf"
+#define SUMMARY_FILE_NAME "SimulatorLogFile.csv"
 
 //Process States
 typedef enum
@@ -36,13 +45,31 @@ typedef enum
 } ProcessState;
 
 //PCB data structure
-typedef struct 
+typedef struct PCB
 {
    ProcessState pState;
    int pId;
    int remainingTimeMs;
+   int opRemainingMs;
+   int ioCount;
+   int homeCore;
+   int sliceMs;
+   int weight;
+   long long vruntimeUs;
+   long long cpuMs;
+   long long readySinceUs;
+   long long readyWaitUs;
+   long long deadlineUs;
+   long long arrivalUs;
+   long long firstDispatchUs;
+   long long completionUs;
+   long long blockedSinceUs;
+   long long blockedUs;
+   int arrivalRank;
+   int lastCore;
    OpCodeType* programCounter;
    MMU mmuInfo;
+   IORequest* ioRequest;
    
 } PCB;
 
@@ -62,12 +89,18 @@ typedef enum
    CreatePCBs,
    AllProcNEW,
    AllProcREADY,
+   ProcArrived,
    Interrupt,
+   InterruptBatch,
    ProcOpStart,
    ProcOpEnd,
    ProcSelected,
+   ContextSwitch,
    ProcSetIn,
    ProcBlocked,
+   ProcPreempted,
+   ProcStolen,
+   DeadlineMissed,
    ProcEnd,
    MMUAllocAttempt,
    MMUAllocSuccess,
@@ -83,24 +116,35 @@ typedef enum
 } LogCode;
 
 //Event Logger Event Data
-typedef struct
+//NOTE: named, so ConfigAccess.h can declare event callbacks taking it
+typedef struct EventData
 {
    char* timeToPrint;
    EventType eventType;
    LogCode logCode;
    int pId;
    int remainingTime;
+   int batchSize;
+   int coreId;
+   int stolenFrom;
+   long long latenessUs;
+   long long overheadUs;
    char* pStateStr;
    char* opStartOrEnd;
    char opType[80];
+   char opLtr;
+   int deviceCode;
    MMU mmuData;
 } EventData;
 
 //linked list for log structures
+//NOTE: tail is only maintained on the head node, so appends are O(1)
+//      logLine is sized to its string, always allocate with createLogNode
 typedef struct LogLinkedList
 {
-   char logLine[80];
    struct LogLinkedList* next;
+   struct LogLinkedList* tail;
+   char logLine[];
    
 } LogLinkedList;
 
@@ -114,15 +158,226 @@ typedef enum
    ISEMPTY,
    ISFULL,
    HEAD,
-   REAR
+   REAR,
+   SIZE,
+   HEAD_AGE,
+   HEAD_WAIT,
+   BATCH_DEQUEUE
    
 } InterruptAction;
 
+//Interrupt record kinds, a batch record is the first dequeue of a coalesced
+//batch, and the dequeues after it up to the next batch record belong to it
+typedef enum
+{
+   RECORD_ENQUEUE,
+   RECORD_DEQUEUE,
+   RECORD_BATCH
+   
+} RecordKind;
+
+//Interrupt queue order being recorded, each record is kept as us from the
+//start of the run, as a gap from the record before it
+typedef struct
+{
+   FILE* filePtr;
+   char* fileName;
+   long long originUs;
+   long long lastUs;
+   
+} InterruptRecorder;
+
+//One dequeue read back from a recording
+typedef struct
+{
+   long long timeUs;
+   int pId;
+   RecordKind kind;
+   
+} InterruptRecord;
+
+//Where a replay may service interrupts, when one is raised, when a flush
+//event comes due, when a CPU has nothing to run, or when nothing is left on
+//the calendar
+typedef enum
+{
+   REPLAY_RAISE,
+   REPLAY_FLUSH,
+   REPLAY_IDLE,
+   REPLAY_STUCK
+   
+} ReplayTrigger;
+
+//Recording being replayed, ioDoneUs holds each process's enqueue times in
+//order, from ioFirst[pId] up to ioFirst[pId + 1]. A real time recording's
+//dequeues are held to their times by flush events the replay sets itself
+typedef struct
+{
+   Boolean realTime;
+   InterruptRecord* dequeues;
+   int dequeueCount;
+   int nextDequeue;
+   long long* ioDoneUs;
+   int* ioFirst;
+   int* ioNext;
+   long long flushUs;
+   long long followed;
+   long long diverged;
+   
+} InterruptReplay;
+
+//Interrupt servicing totals, a batch is one pass of the interrupt handler
+typedef struct
+{
+   long long serviced;
+   long long batches;
+   int maxBatch;
+   
+} InterruptStats;
+
+//Deadline totals, over the processes given an A(deadline)N op
+typedef struct
+{
+   int deadlines;
+   int missed;
+   long long totalLatenessUs;
+   long long maxLatenessUs;
+   
+} DeadlineStats;
+
+//Latency histograms over the run, op run and interrupt delivery are in us
+//of the simulation clock, scheduler decisions in ns of host time
+typedef struct
+{
+   LatencyHistogram opRunUs;
+   LatencyHistogram interruptUs;
+   LatencyHistogram decisionNs;
+   
+} LatencyStats;
+
+//CPU core totals, a steal is a process taken from another core's run queue,
+//ready wait is the time from READY to dispatch, and a context switch is a
+//dispatch of a different process than the core last ran
+typedef struct
+{
+   long long busyUs;
+   long long dispatches;
+   long long steals;
+   long long readyWaitUs;
+   long long maxReadyWaitUs;
+   long long contextSwitches;
+   long long switchOverheadUs;
+   long long warmupUs;
+   
+} CoreStats;
+
+//Spread of one time over the completed processes
+typedef struct
+{
+   double meanMs;
+   double p50Ms;
+   double p95Ms;
+   double p99Ms;
+   
+} MetricSummary;
+
+//Performance over a whole run, as given in its Performance Summary,
+//cpuUtilisation is a percentage of every core's time
+typedef struct
+{
+   int processCount;
+   int completedCount;
+   int coreCount;
+   long long elapsedUs;
+   double throughput;
+   double cpuUtilisation;
+   long long contextSwitches;
+   MetricSummary turnaround;
+   MetricSummary waiting;
+   MetricSummary response;
+   
+} RunSummary;
+
+//Interrupts raised by the I/O threads, waiting for a core to service them
+typedef struct
+{
+   pthread_mutex_t queueLock;
+   int* queue;
+   long long* raisedUs;
+   int size;
+   int headOffset;
+   int rearOffset;
+   int maxCap;
+   InterruptRecorder* recorder;
+   ConfigDataType* configDataPtr;
+   
+} InterruptQueue;
+
+//Stack of the I/O threads started over a run
+typedef struct
+{
+   pthread_t* threads;
+   int currentOffset;
+   int maxCap;
+   
+} ThreadStack;
+
+//Real time simulation state, one per simulationRunner call and shared by
+//its cores and I/O threads, so runs in the same process never meet
+typedef struct
+{
+   pthread_mutex_t simMutex;
+   SimTimer simTimer;
+   InterruptQueue interruptQueue;
+   InterruptRecorder recorder;
+   ThreadStack threadStack;
+   
+} SimContext;
+
+//Real time CPU core, each core thread runs the scheduling loop on its own
+//run queue, every pointer but coreStats is shared by all of the cores
+typedef struct
+{
+   int coreId;
+   SimContext* simContext;
+   int scheduledProcess;
+   ConfigDataType* configDataPtr;
+   PCB* pcbArray;
+   int processCount;
+   LogLinkedList* listCurrentPtr;
+   MMU* mmuCurrentPtr;
+   MMU* mmuHeadPtr;
+   DeviceTable* deviceTable;
+   InterruptStats* interruptStats;
+   DeadlineStats* deadlineStats;
+   LatencyStats* latencyStats;
+   EventQueue* arrivalQueue;
+   Boolean staggeredArrivals;
+   long long startUs;
+   Scheduler* schedulers;
+   Boolean* coresBusy;
+   CoreStats coreStats;
+   
+} CoreContext;
+
+//Virtual clock CPU core
+typedef struct
+{
+   int runningProcess;
+   int lastDispatched;
+   long long busySinceUs;
+   CoreStats coreStats;
+   
+} SimCore;
+
 //ThreadInput data structure
 typedef struct 
 {
    int pId;
    int timeToWait;
+   Device* device;
+   IORequest* ioRequest;
+   InterruptQueue* interruptQueue;
    
 } ThreadInput;
 
@@ -137,23 +392,123 @@ typedef enum
    
 } ThreadAction;
 
+//Virtual clock simulation state, shared by the EventRunner.c handlers
+typedef struct
+{
+   ConfigDataType* configDataPtr;
+   PCB* pcbArray;
+   int processCount;
+   int exitCount;
+   EventQueue eventQueue;
+   long long clockUs;
+   long long eventCount;
+   Boolean staggeredArrivals;
+   int coreCount;
+   SimCore* cores;
+   Scheduler* schedulers;
+   LogLinkedList* listHeadPtr;
+   MMU* mmuHeadPtr;
+   DeviceTable deviceTable;
+   int* pendingInterrupts;
+   long long* pendingRaisedUs;
+   int pendingCount;
+   long long pendingSinceUs;
+   InterruptStats interruptStats;
+   DeadlineStats deadlineStats;
+   LatencyStats latencyStats;
+   long long nextCheckpointUs;
+   InterruptRecorder recorder;
+   InterruptReplay* replay;
+   
+} EventSimulation;
+
 
 //function prototypes for SimRunner.c
-int simulationRunner( ConfigDataType* configDataPtr, OpCodeType* mdData );
-int cpuScheduler( PCB* pcbArray, int processCount, 
-                                                ConfigDataType* configDataPtr );
+int simulationRunner( ConfigDataType* configDataPtr, OpCodeType* mdData,
+                                                   RunSummary* runSummaryPtr );
+void* coreRunner( void* coreInput );
+void simulationLock( SimContext* context, Boolean acquire );
+Boolean allProcessesExited( PCB* pcbArray, int processCount );
+int coreScheduler( Scheduler* schedulers, int coreCount, PCB* pcbArray,
+                        Boolean* coresBusy, int coreId, int* victimCore );
+void makeReady( ConfigDataType* configDataPtr, Scheduler* schedulers,
+                                             PCB* process, long long nowUs );
+void setProcessState( ConfigDataType* configDataPtr, PCB* process,
+                                                      ProcessState pState );
+void markDispatched( CoreStats* coreStats, PCB* process, long long nowUs );
+long long chargeDispatch( CoreStats* coreStats, PCB* process, int coreId,
+                        Boolean switched, ConfigDataType* configDataPtr );
+long long checkDeadline( DeadlineStats* deadlineStats, PCB* process,
+                                                         long long elapsedUs );
 int operationRunner( int scheduledProcess, OpCodeType* programCounter, 
                                  ConfigDataType* configDataPtr, PCB* pcbArray,
                                     LogLinkedList* listCurrentPtr,
-                                       MMU* mmuCurrentPtr, MMU* mmuHeadPtr );
+                                       MMU* mmuCurrentPtr, MMU* mmuHeadPtr,
+                                          DeviceTable* deviceTable,
+                                                   SimContext* context );
 void *threadRunTimer( void* threadInput );
-pthread_t threadManager(ThreadAction action, ThreadInput* threadInput);
+pthread_t threadManager( ThreadStack* threadStack, ThreadAction action,
+                                                ThreadInput* threadInput );
 int findProcessCount( OpCodeType* loopMetaDataPtr, OpCodeType* mdData );
 void createPCBs( PCB* pcbArray, OpCodeType* loopMetaDataPtr, int processCount );
-void initInReady( PCB* pcbArray, int processCount );
+OpCodeType* readProcessAttributes( PCB* process, OpCodeType* opCode );
+Boolean assignArrivals( PCB* pcbArray, int processCount, 
+                                          ConfigDataType* configDataPtr );
+int compareArrivals( const void* first, const void* second );
+void admitArrivals( CoreContext* core );
+unsigned long long seedRandom( int seed );
+unsigned long long nextRandom( unsigned long long* randomState );
+double nextRandomUnit( unsigned long long* randomState );
+void assignCores( PCB* pcbArray, int processCount, int coreCount );
 void calcRemainingTimes( PCB* pcbArray, ConfigDataType* configDataPtr, 
                                                             int processCount );
-int interruptQueue(InterruptAction action, int pId, int processCount);
+int interruptQueue( InterruptQueue* interrupts, InterruptAction action,
+                                                   int pId, int processCount );
+MMU getMemoryRequest( int pId, int opValue );
+Boolean interruptCoalescing( ConfigDataType* configDataPtr );
+Boolean interruptBatchDue( ConfigDataType* configDataPtr, int pendingCount,
+                                       long long pendingAgeUs, Boolean idle );
+
+//function prototypes for EventRunner.c
+int eventSimulationRunner( ConfigDataType* configDataPtr, OpCodeType* mdData,
+                                                   RunSummary* runSummaryPtr );
+Boolean dispatchProcess( EventSimulation* sim, int coreId );
+void releaseCore( EventSimulation* sim, int pId );
+void startOperation( EventSimulation* sim, int pId );
+void handleSimEvent( EventSimulation* sim, SimEvent simEvent );
+void exitProcess( EventSimulation* sim, int pId );
+void raiseInterrupt( EventSimulation* sim, int pId );
+void serviceInterrupts( EventSimulation* sim );
+void logSimEvent( EventSimulation* sim, EventType eventType, LogCode logCode,
+                                                                     int pId );
+void virtualTimeToString( long long timeUs, char* timeString );
+void seedMetrics( EventSimulation* sim );
+void destructSimulation( EventSimulation* sim );
+
+//function prototypes for Checkpoint.c
+void checkpointArm( EventSimulation* sim );
+Boolean checkpointDue( EventSimulation* sim );
+Boolean writeCheckpoint( EventSimulation* sim, OpCodeType* mdData );
+Boolean restoreCheckpoint( EventSimulation* sim, OpCodeType* mdData );
+
+//function prototypes for Replay.c
+void recordOpen( InterruptRecorder* recorder, ConfigDataType* configDataPtr,
+               int processCount, long long originUs, Boolean realTime );
+void recordInterrupt( InterruptRecorder* recorder, RecordKind kind, int pId,
+                                                            long long nowUs );
+void recordClose( InterruptRecorder* recorder );
+InterruptReplay* replayLoad( char* fileName, int processCount );
+long long replayIoDone( EventSimulation* sim, int pId, long long defaultUs );
+void replayInterrupt( EventSimulation* sim, int pId );
+Boolean replayService( EventSimulation* sim, ReplayTrigger trigger );
+void logReplayStats( InterruptReplay* replay, ConfigDataType* configDataPtr,
+                                                LogLinkedList* listHeadPtr );
+InterruptReplay* replayDestruct( InterruptReplay* replay );
+
+//function prototypes for Trace.c
+void traceOpen( ConfigDataType* configDataPtr );
+void traceEvent( EventData* eventData, ConfigDataType* configDataPtr );
+void traceClose( ConfigDataType* configDataPtr );
 
 //function prototypes for Logger.c
 void eventLogger(EventData eventData, ConfigDataType* configDataPtr,
@@ -161,7 +516,42 @@ void eventLogger(EventData eventData, ConfigDataType* configDataPtr,
 EventData generateEventData(EventType eventType, LogCode logCode, 
                   char* timeString, OpCodeType* programCounter, PCB* process);
 void logToFile(LogLinkedList* listCurrentPtr, ConfigDataType* configDataPtr );
+void reportLogger( char* reportLine, ConfigDataType* configDataPtr,
+                                                LogLinkedList* listHeadPtr );
+void logDeviceStats( DeviceTable* deviceTable, long long nowUs,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void logInterruptStats( InterruptStats* interruptStats,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void logDeadlineStats( DeadlineStats* deadlineStats,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void logSchedulingStats( PCB* pcbArray, int processCount,
+                           CoreStats* coreStats, int coreCount,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void summariseRun( RunSummary* runSummary, PCB* pcbArray, int processCount,
+                  CoreStats* coreStats, int coreCount, long long originUs,
+                                                         long long elapsedUs );
+void summariseMetric( MetricSummary* metric, long long* valuesUs, int count );
+void logPerformanceSummary( RunSummary* runSummary,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void logMetricSummary( char* metricName, MetricSummary* metric,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void summaryLogger( char* reportLine, ConfigDataType* configDataPtr,
+                                                LogLinkedList* listHeadPtr );
+int compareTimes( const void* first, const void* second );
+void writeSummaryFile( PCB* pcbArray, int processCount, long long originUs );
+void logLatencyStats( LatencyStats* latencyStats, DeviceTable* deviceTable,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void logHistogram( char* histogramName, LatencyHistogram* histogram,
+            double valuesPerUnit, char* unitName,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void printProfileStats( void );
+void logOverheadStats( CoreStats* coreStats, int coreCount,
+               ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+void logCoreStats( CoreStats* coreStats, int coreCount, long long elapsedUs,
+                  ConfigDataType* configDataPtr, LogLinkedList* listHeadPtr );
+LogLinkedList* createLogNode( char* logLine );
 LogLinkedList* addNodeLL( LogLinkedList* localPtr, LogLinkedList* newNode );
+void appendNodeLL( LogLinkedList* listHeadPtr, LogLinkedList* newNode );
 LogLinkedList* clearLinkedList( LogLinkedList* localPtr );
 
 
@@ -0,0 +1,431 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Sweep.c
+ *
+ *
+ * @version 5.50
+ *          Kristopher Moore (19 October 2026)
+ *          Parameter sweep of one workload over a grid of configs.
+ */
+
+//needs simRunner for the runners, configs and run summaries
+#include "SimRunner.h"
+
+//largest number of values given for one swept setting
+#define MAX_SWEEP_VALUES 64
+
+//values of one swept setting, a single value when it is not swept
+typedef struct
+{
+   char* flagName;
+   int lineCode;
+   int values[ MAX_SWEEP_VALUES ];
+   int count;
+
+} SweepAxis;
+
+//settings swept, in the order they vary, the last fastest
+typedef enum
+{
+   AXIS_SCHED,
+   AXIS_QUANTUM,
+   AXIS_PROC_RATE,
+   AXIS_IO_RATE,
+   AXIS_MEMORY,
+   AXIS_COUNT
+
+} SweepAxisCode;
+
+//one grid point, its config and the summary of its run
+typedef struct
+{
+   ConfigDataType config;
+   RunSummary runSummary;
+
+} SweepPoint;
+
+//work shared by the pool, points are handed out in order under the lock
+typedef struct
+{
+   pthread_mutex_t lock;
+   SweepPoint* points;
+   int pointCount;
+   int nextPoint;
+   OpCodeType* mdData;
+
+} SweepPool;
+
+//function prototypes
+void showSweepUsage( void );
+Boolean readSweepAxis( SweepAxis* axis, char* valueList );
+int buildSweepGrid( SweepAxis* axes, ConfigDataType* baseConfig,
+                                                      SweepPoint** points );
+void* sweepWorker( void* poolInput );
+Boolean writeSweepFile( char* fileName, SweepPoint* points, int pointCount );
+
+/*
+Function name: main
+Algorithm: reads the base config and its meta data once, builds the grid
+            of configs from the flags, runs every point on a pool of
+            threads, and writes one CSV row per point
+Precondition: base config file and its meta data file
+Postcondition: returns zero (0) on success
+Exceptions: bad flags or values print the usage, bad files their error
+Notes: every point runs on the virtual clock with no log, its settings are
+       the base config's but for the swept ones
+*/
+int main( int argc, char** argv )
+{
+   SweepAxis axes[ AXIS_COUNT ] =
+      { { "--sched", CFG_CPU_SCHED_CODE, { 0 }, 0 },
+        { "--quantum", CFG_QUANT_CYCLES_CODE, { 0 }, 0 },
+        { "--proc", CFG_PROC_CYCLES_CODE, { 0 }, 0 },
+        { "--io", CFG_IO_CYCLES_CODE, { 0 }, 0 },
+        { "--memory", CFG_MEM_AVAILABLE_CODE, { 0 }, 0 } };
+   ConfigDataType* baseConfig;
+   OpCodeType* mdData = NULL;
+   SweepPool pool;
+   char outFileName[ MAX_STR_LEN ];
+   pthread_t* threads;
+   int threadCount = 4;
+   int result;
+   int index;
+   int axis;
+   long long startNs;
+
+   if( argc < 2 || argc % 2 != 0 )
+   {
+      showSweepUsage();
+      return 1;
+   }
+
+   copyString( outFileName, "SimSweep.csv" );
+   for( index = 2; index < argc; index += 2 )
+   {
+      for( axis = 0; axis < AXIS_COUNT; axis++ )
+      {
+         if( compareString( argv[ index ], axes[ axis ].flagName ) == STR_EQ )
+         {
+            break;
+         }
+      }
+
+      if( axis < AXIS_COUNT )
+      {
+         if( readSweepAxis( &axes[ axis ], argv[ index + 1 ] ) == False )
+         {
+            printf( "Bad value list %s for %s\n", argv[ index + 1 ],
+                                                            argv[ index ] );
+            showSweepUsage();
+            return 1;
+         }
+      }
+      else if( compareString( argv[ index ], "--threads" ) == STR_EQ )
+      {
+         threadCount = atoi( argv[ index + 1 ] );
+      }
+      else if( compareString( argv[ index ], "--out" ) == STR_EQ )
+      {
+         copyString( outFileName, argv[ index + 1 ] );
+      }
+      else
+      {
+         showSweepUsage();
+         return 1;
+      }
+   }
+
+   if( threadCount < 1 )
+   {
+      showSweepUsage();
+      return 1;
+   }
+
+   result = getConfigData( argv[ 1 ], &baseConfig );
+   if( result != NO_ERR )
+   {
+      displayConfigError( result );
+      return 1;
+   }
+
+   //parsed once, every run only reads it
+   result = getOpCodes( baseConfig->metaDataFileName, &mdData );
+   if( result != NO_ERR )
+   {
+      displayMetaDataError( result );
+      clearConfigData( &baseConfig );
+      return 1;
+   }
+
+   pool.pointCount = buildSweepGrid( axes, baseConfig, &pool.points );
+   pool.nextPoint = 0;
+   pool.mdData = mdData;
+   pthread_mutex_init( &pool.lock, NULL );
+   if( threadCount > pool.pointCount )
+   {
+      threadCount = pool.pointCount;
+   }
+
+   printf( "Sweeping %d points of %s on %d threads\n", pool.pointCount,
+                              baseConfig->metaDataFileName, threadCount );
+   startNs = wallTimeNs();
+
+   threads = (pthread_t*) malloc( sizeof( pthread_t ) * threadCount );
+   for( index = 0; index < threadCount; index++ )
+   {
+      pthread_create( &threads[ index ], NULL, sweepWorker, &pool );
+   }
+   for( index = 0; index < threadCount; index++ )
+   {
+      pthread_join( threads[ index ], NULL );
+   }
+
+   printf( "Swept %d points in %.3f s\n", pool.pointCount,
+                                       ( wallTimeNs() - startNs ) / 1e9 );
+   if( writeSweepFile( outFileName, pool.points, pool.pointCount ) == True )
+   {
+      printf( "Wrote %s\n", outFileName );
+   }
+   else
+   {
+      printf( "Unable to write %s\n", outFileName );
+   }
+
+   pthread_mutex_destroy( &pool.lock );
+   free( threads );
+   free( pool.points );
+   clearMetaDataList( mdData );
+   clearConfigData( &baseConfig );
+   return 0;
+}
+
+/*
+Function name: showSweepUsage
+Algorithm: prints the flags and their defaults
+Precondition: none
+Postcondition: usage printed
+Exceptions: none
+Notes: none
+*/
+void showSweepUsage( void )
+{
+   printf( "Usage: SimSweep base.cnf [flag values]...\n" );
+   printf( "  values are comma separated, a setting not swept keeps the\n" );
+   printf( "  base config's value\n" );
+   printf( "  --sched a,b        CPU Scheduling Codes\n" );
+   printf( "  --quantum n,m      Quantum Time (cycles)\n" );
+   printf( "  --proc n,m         Processor Cycle Time (msec)\n" );
+   printf( "  --io n,m           I/O Cycle Time (msec)\n" );
+   printf( "  --memory n,m       Memory Available (KB)\n" );
+   printf( "  --threads n        worker threads (4)\n" );
+   printf( "  --out file         results CSV (SimSweep.csv)\n" );
+}
+
+/*
+Function name: readSweepAxis
+Algorithm: splits a comma separated list, and checks each value is in the
+            range the config file allows for the setting
+Precondition: axis with its line code
+Postcondition: values stored, returns False on a bad or over long list
+Exceptions: none
+Notes: scheduler values are names, stored as their registry codes
+*/
+Boolean readSweepAxis( SweepAxis* axis, char* valueList )
+{
+   char valueStr[ MAX_STR_LEN ];
+   int valueLength;
+   int value;
+
+   axis->count = 0;
+   while( *valueList != NULL_CHAR )
+   {
+      valueLength = 0;
+      while( valueList[ valueLength ] != ','
+                  && valueList[ valueLength ] != NULL_CHAR
+                                       && valueLength < MAX_STR_LEN - 1 )
+      {
+         valueStr[ valueLength ] = valueList[ valueLength ];
+         valueLength++;
+      }
+      valueStr[ valueLength ] = NULL_CHAR;
+      valueList += valueLength;
+      if( *valueList == ',' )
+      {
+         valueList++;
+      }
+
+      if( axis->lineCode == CFG_CPU_SCHED_CODE )
+      {
+         value = findSchedulerCode( valueStr );
+         if( value < 0 )
+         {
+            return False;
+         }
+      }
+      else
+      {
+         value = atoi( valueStr );
+         if( valueLength == 0
+            || valueInRange( axis->lineCode, value, 0.0, valueStr ) == False )
+         {
+            return False;
+         }
+      }
+
+      if( axis->count == MAX_SWEEP_VALUES )
+      {
+         return False;
+      }
+      axis->values[ axis->count ] = value;
+      axis->count++;
+   }
+
+   return axis->count > 0 ? True : False;
+}
+
+/*
+Function name: buildSweepGrid
+Algorithm: fills in the base config's value for each setting not swept,
+            then writes one config for every combination of values
+Precondition: axes read from the flags, base config loaded
+Postcondition: returns the point count, points allocated
+Exceptions: none
+Notes: points run on the virtual clock, with no log, trace, checkpoint,
+       interrupt recording or metrics socket, since the runs share the
+       monitor and the files
+*/
+int buildSweepGrid( SweepAxis* axes, ConfigDataType* baseConfig,
+                                                      SweepPoint** points )
+{
+   const int baseValues[ AXIS_COUNT ] = { baseConfig->cpuSchedCode,
+         baseConfig->quantumCycles, baseConfig->procCycleRate,
+                     baseConfig->ioCycleRate, baseConfig->memAvailable };
+   int valueIndex[ AXIS_COUNT ];
+   ConfigDataType* config;
+   int pointCount = 1;
+   int point;
+   int remainder;
+   int axis;
+
+   for( axis = 0; axis < AXIS_COUNT; axis++ )
+   {
+      if( axes[ axis ].count == 0 )
+      {
+         axes[ axis ].values[ 0 ] = baseValues[ axis ];
+         axes[ axis ].count = 1;
+      }
+      pointCount *= axes[ axis ].count;
+   }
+
+   *points = (SweepPoint*) malloc( sizeof( SweepPoint ) * pointCount );
+   for( point = 0; point < pointCount; point++ )
+   {
+      remainder = point;
+      for( axis = AXIS_COUNT - 1; axis >= 0; axis-- )
+      {
+         valueIndex[ axis ] = remainder % axes[ axis ].count;
+         remainder /= axes[ axis ].count;
+      }
+
+      config = &( *points )[ point ].config;
+      *config = *baseConfig;
+      config->cpuSchedCode =
+                     axes[ AXIS_SCHED ].values[ valueIndex[ AXIS_SCHED ] ];
+      config->quantumCycles =
+                     axes[ AXIS_QUANTUM ].values[ valueIndex[ AXIS_QUANTUM ] ];
+      config->procCycleRate =
+               axes[ AXIS_PROC_RATE ].values[ valueIndex[ AXIS_PROC_RATE ] ];
+      config->ioCycleRate =
+                  axes[ AXIS_IO_RATE ].values[ valueIndex[ AXIS_IO_RATE ] ];
+      config->memAvailable =
+                     axes[ AXIS_MEMORY ].values[ valueIndex[ AXIS_MEMORY ] ];
+      config->simClockCode = SIM_CLOCK_VIRTUAL_CODE;
+      config->logToCode = LOGTO_NONE_CODE;
+      config->traceFileName[ 0 ] = NULL_CHAR;
+      config->checkpointFileName[ 0 ] = NULL_CHAR;
+      config->recordFileName[ 0 ] = NULL_CHAR;
+      config->metricsSocketName[ 0 ] = NULL_CHAR;
+   }
+
+   return pointCount;
+}
+
+/*
+Function name: sweepWorker
+Algorithm: takes the next unrun point from the pool and runs it, until
+            every point is taken
+Precondition: pool filled in, its lock initialised
+Postcondition: each point taken has its run summary
+Exceptions: none
+Notes: each run keeps its own state, the pool lock is only held to take
+       a point
+*/
+void* sweepWorker( void* poolInput )
+{
+   SweepPool* pool = (SweepPool*) poolInput;
+   int point;
+
+   while( True )
+   {
+      pthread_mutex_lock( &pool->lock );
+      point = pool->nextPoint;
+      pool->nextPoint++;
+      pthread_mutex_unlock( &pool->lock );
+
+      if( point >= pool->pointCount )
+      {
+         return NULL;
+      }
+
+      eventSimulationRunner( &pool->points[ point ].config, pool->mdData,
+                                          &pool->points[ point ].runSummary );
+   }
+}
+
+/*
+Function name: writeSweepFile
+Algorithm: writes a header, then one row per point with its settings and
+            its run's performance summary
+Precondition: every point run
+Postcondition: returns True if the file was written
+Exceptions: none
+Notes: times are in ms of the virtual clock
+*/
+Boolean writeSweepFile( char* fileName, SweepPoint* points, int pointCount )
+{
+   FILE* filePtr = fopen( fileName, "w" );
+   SweepPoint* point;
+   RunSummary* summary;
+   int index;
+
+   if( filePtr == NULL )
+   {
+      return False;
+   }
+
+   fprintf( filePtr, "sched,quantum_cycles,proc_cycle_ms,io_cycle_ms,"
+                  "memory_kb,processes,completed,makespan_ms,throughput_per_s,"
+                  "cpu_utilisation_pct,context_switches,turnaround_mean_ms,"
+                  "turnaround_p95_ms,waiting_mean_ms,waiting_p95_ms,"
+                  "response_mean_ms,response_p95_ms\n" );
+
+   for( index = 0; index < pointCount; index++ )
+   {
+      point = &points[ index ];
+      summary = &point->runSummary;
+      fprintf( filePtr, "%s,%d,%d,%d,%d,%d,%d,%.3f,%.3f,%.1f,%lld,"
+                                          "%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+               getSchedulerPolicy( point->config.cpuSchedCode )->name,
+               point->config.quantumCycles, point->config.procCycleRate,
+               point->config.ioCycleRate, point->config.memAvailable,
+               summary->processCount, summary->completedCount,
+               summary->elapsedUs / 1000.0, summary->throughput,
+               summary->cpuUtilisation, summary->contextSwitches,
+               summary->turnaround.meanMs, summary->turnaround.p95Ms,
+               summary->waiting.meanMs, summary->waiting.p95Ms,
+               summary->response.meanMs, summary->response.p95Ms );
+   }
+
+   fclose( filePtr );
+   return True;
+}
@@ -0,0 +1,498 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file Trace.c
+ *
+ *
+ * @version 5.47
+ *          Kristopher Moore (19 October 2026)
+ *          Chrome Trace Event export of the process timeline.
+ */
+
+//needs simRunner for the EventData definition
+#include "SimRunner.h"
+
+//trace processes, each holds one track per process, device or core
+#define TRACE_PID_PROCESSES 1
+#define TRACE_PID_DEVICES 2
+#define TRACE_PID_CORES 3
+
+//what the trace needs to remember of a process between its events
+typedef struct
+{
+   Boolean named;
+   Boolean opOpen;
+   char opLtr;
+   int deviceCode;
+   char opName[ 80 ];
+   long long opStartUs;
+   long long runStartUs;
+   int runCore;
+   long long mmuStartUs;
+
+} TraceProcess;
+
+//the open trace, NULL unless the config of a run names a trace file, and
+//the config of that run, only its events are written
+static FILE* traceFile = NULL;
+static ConfigDataType* traceOwner = NULL;
+static TraceProcess* traceProcesses = NULL;
+static int traceCapacity = 0;
+
+//held by open and close, so runs starting or ending at once take turns
+static pthread_mutex_t traceLock = PTHREAD_MUTEX_INITIALIZER;
+
+//static helpers
+static long long traceTimeUs( char* timeString );
+static TraceProcess* traceProcess( int pId );
+static char* traceName( char* opType );
+static void traceSlice( int tracePid, int traceTid, const char* name,
+                                       long long startUs, long long endUs );
+static void traceInstant( int tracePid, int traceTid, const char* name,
+                                          long long timeUs, char scope );
+static void traceRequest( int deviceCode, int pId, long long startUs,
+                                                         long long endUs );
+static void traceThreadName( int tracePid, int traceTid, const char* name );
+static void traceRunEnd( TraceProcess* process, int pId, long long nowUs );
+
+/*
+Function name: traceOpen
+Algorithm: opens the trace file named by the config, and writes the names of
+            the track groups, the cores and the devices
+Precondition: config data loaded, called before the first event is logged
+Postcondition: trace open if a trace file is named, otherwise nothing
+Exceptions: an unopenable file is reported, and the run goes on untraced
+Notes: only one run in the process is traced at a time, a run starting
+       while another is traced is reported, and goes on untraced
+*/
+void traceOpen( ConfigDataType* configDataPtr )
+{
+   FILE* filePtr;
+   int index;
+
+   if( configDataPtr->traceFileName[ 0 ] == NULL_CHAR )
+   {
+      return;
+   }
+
+   pthread_mutex_lock( &traceLock );
+   if( traceFile != NULL )
+   {
+      printf( "Trace file %s not opened, another run is being traced\n",
+                                             configDataPtr->traceFileName );
+      pthread_mutex_unlock( &traceLock );
+      return;
+   }
+
+   filePtr = fopen( configDataPtr->traceFileName, "w" );
+   if( filePtr == NULL )
+   {
+      printf( "Unable to open trace file %s, run not traced\n",
+                                             configDataPtr->traceFileName );
+      pthread_mutex_unlock( &traceLock );
+      return;
+   }
+   traceFile = filePtr;
+
+   fprintf( traceFile, "[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                  "\"args\":{\"name\":\"Processes\"}}", TRACE_PID_PROCESSES );
+   fprintf( traceFile, ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                  "\"args\":{\"name\":\"Devices\"}}", TRACE_PID_DEVICES );
+   fprintf( traceFile, ",\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+                  "\"args\":{\"name\":\"CPU Cores\"}}", TRACE_PID_CORES );
+
+   for( index = 0; index < DEVICE_COUNT; index++ )
+   {
+      traceThreadName( TRACE_PID_DEVICES, index, getDeviceName( index ) );
+   }
+
+   for( index = 0; index < configDataPtr->cpuCores; index++ )
+   {
+      fprintf( traceFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+                  "\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"Core %d\"}}",
+                                          TRACE_PID_CORES, index, index );
+   }
+
+#ifdef __GNUC__
+   __atomic_store_n( &traceOwner, configDataPtr, __ATOMIC_RELEASE );
+#else
+   traceOwner = configDataPtr;
+#endif
+   pthread_mutex_unlock( &traceLock );
+}
+
+/*
+Function name: traceEvent
+Algorithm: turns the logged event into trace events, op start and end, and
+            MMU attempt and result, become slices on the process's track,
+            its I/O requests also on their device's track, its run ops on
+            its core's track, interrupts and seg faults become instants
+Precondition: eventData from generateEventData, configDataPtr of the run
+               logging it
+Postcondition: trace events written, if the run's trace is open
+Exceptions: none
+Notes: called by eventLogger for every event of every run, the events of
+       any run but the traced one are skipped. The traced run logs only
+       under its own simulation lock, so its events need no lock of their
+       own. Slices are written at their end, so each event is written once
+       as it happens, never held back
+*/
+void traceEvent( EventData* eventData, ConfigDataType* configDataPtr )
+{
+   TraceProcess* process;
+   long long nowUs;
+   int pId = eventData->pId;
+
+#ifdef __GNUC__
+   if( __atomic_load_n( &traceOwner, __ATOMIC_ACQUIRE ) != configDataPtr )
+#else
+   if( traceOwner != configDataPtr )
+#endif
+   {
+      return;
+   }
+
+   nowUs = traceTimeUs( eventData->timeToPrint );
+
+   //batches belong to no process, mark them on every core
+   if( eventData->logCode == InterruptBatch )
+   {
+      traceInstant( TRACE_PID_CORES, 0, "interrupt batch", nowUs, 'p' );
+      return;
+   }
+
+   if( pId < 0 )
+   {
+      return;
+   }
+
+   process = traceProcess( pId );
+
+   switch( eventData->logCode )
+   {
+      //an op begins, run ops also begin running on their core
+      case ProcOpStart:
+         process->opOpen = True;
+         process->opLtr = eventData->opLtr;
+         process->deviceCode = eventData->deviceCode;
+         process->opStartUs = nowUs;
+         copyString( process->opName, traceName( eventData->opType ) );
+
+         if( eventData->opLtr == 'P' )
+         {
+            process->runStartUs = nowUs;
+            process->runCore = eventData->coreId < 0 ? 0 : eventData->coreId;
+         }
+         break;
+
+      //a run op ends
+      case ProcOpEnd:
+         traceRunEnd( process, pId, nowUs );
+         if( process->opOpen == True )
+         {
+            traceSlice( TRACE_PID_PROCESSES, pId, process->opName,
+                                                process->opStartUs, nowUs );
+            process->opOpen = False;
+         }
+         break;
+
+      //a preempted run op goes back on a core when it is selected again
+      case ProcSelected:
+         if( process->opOpen == True && process->opLtr == 'P'
+                                             && process->runStartUs < 0 )
+         {
+            process->runStartUs = nowUs;
+            process->runCore = eventData->coreId < 0 ? 0 : eventData->coreId;
+         }
+         break;
+
+      //the dispatch cost holds the core before the op runs
+      case ContextSwitch:
+         traceSlice( TRACE_PID_CORES,
+                     eventData->coreId < 0 ? 0 : eventData->coreId,
+                     "context switch", nowUs, nowUs + eventData->overheadUs );
+         break;
+
+      case ProcPreempted:
+         traceRunEnd( process, pId, nowUs );
+         break;
+
+      //an interrupt ends the process's I/O op
+      case Interrupt:
+         if( process->opOpen == True && process->opLtr != 'P' )
+         {
+            traceSlice( TRACE_PID_PROCESSES, pId, process->opName,
+                                                process->opStartUs, nowUs );
+            if( process->deviceCode >= 0 )
+            {
+               traceRequest( process->deviceCode, pId,
+                                                process->opStartUs, nowUs );
+            }
+            process->opOpen = False;
+         }
+         traceInstant( TRACE_PID_PROCESSES, pId, "interrupt", nowUs, 't' );
+         break;
+
+      case MMUAllocAttempt:
+      case MMUAccessAttempt:
+         process->mmuStartUs = nowUs;
+         break;
+
+      case MMUAllocSuccess:
+      case MMUAllocFailed:
+         traceSlice( TRACE_PID_PROCESSES, pId,
+            eventData->logCode == MMUAllocSuccess ? "mmu allocate"
+                     : "mmu allocate failed", process->mmuStartUs, nowUs );
+         break;
+
+      case MMUAccessSuccess:
+      case MMUAccessFailed:
+         traceSlice( TRACE_PID_PROCESSES, pId,
+            eventData->logCode == MMUAccessSuccess ? "mmu access"
+                     : "mmu access failed", process->mmuStartUs, nowUs );
+         break;
+
+      case SegFault:
+         traceInstant( TRACE_PID_PROCESSES, pId, "segmentation fault",
+                                                                  nowUs, 't' );
+         break;
+
+      case DeadlineMissed:
+         traceInstant( TRACE_PID_PROCESSES, pId, "deadline missed",
+                                                                  nowUs, 't' );
+         break;
+
+      case ProcEnd:
+         traceRunEnd( process, pId, nowUs );
+         break;
+
+      default:
+         break;
+   }
+}
+
+/*
+Function name: traceClose
+Algorithm: ends the event array, closes the file and frees the process table
+Precondition: configDataPtr is the config of a run calling traceOpen
+Postcondition: trace complete, no trace open, if the run was traced
+Exceptions: none
+Notes: safe to call when the run was not traced, the trace of another run
+       is left open
+*/
+void traceClose( ConfigDataType* configDataPtr )
+{
+   pthread_mutex_lock( &traceLock );
+   if( traceFile != NULL && traceOwner == configDataPtr )
+   {
+#ifdef __GNUC__
+      __atomic_store_n( &traceOwner, NULL, __ATOMIC_RELEASE );
+#else
+      traceOwner = NULL;
+#endif
+      fprintf( traceFile, "\n]\n" );
+      fclose( traceFile );
+      traceFile = NULL;
+
+      free( traceProcesses );
+      traceProcesses = NULL;
+      traceCapacity = 0;
+   }
+   pthread_mutex_unlock( &traceLock );
+}
+
+/*
+Function name: traceTimeUs
+Algorithm: reads the seconds and micro-seconds back out of a logged time
+Precondition: timeString formatted by timeToString
+Postcondition: returns the time in micro-seconds
+Exceptions: none
+Notes: both runners log times from the start of the run, as the trace wants
+*/
+static long long traceTimeUs( char* timeString )
+{
+   long long seconds = 0;
+   long long microSeconds = 0;
+   int digits = 0;
+
+   while( *timeString == SPACE )
+   {
+      timeString++;
+   }
+
+   while( *timeString >= '0' && *timeString <= '9' )
+   {
+      seconds = seconds * 10 + ( *timeString - '0' );
+      timeString++;
+   }
+
+   if( *timeString == RADIX_POINT )
+   {
+      timeString++;
+   }
+
+   while( digits < 6 && *timeString >= '0' && *timeString <= '9' )
+   {
+      microSeconds = microSeconds * 10 + ( *timeString - '0' );
+      timeString++;
+      digits++;
+   }
+
+   return seconds * 1000000 + microSeconds;
+}
+
+/*
+Function name: traceProcess
+Algorithm: finds the process's entry, doubling the table to fit a new pId,
+            and names the process's track the first time it is seen
+Precondition: trace open, pId not negative
+Postcondition: returns the process's entry
+Exceptions: none
+Notes: none
+*/
+static TraceProcess* traceProcess( int pId )
+{
+   TraceProcess* process;
+   char trackName[ STD_STR_LEN ];
+   int newCapacity = traceCapacity == 0 ? 64 : traceCapacity;
+   int index;
+
+   if( pId >= traceCapacity )
+   {
+      while( newCapacity <= pId )
+      {
+         newCapacity *= 2;
+      }
+
+      traceProcesses = (TraceProcess*) realloc( traceProcesses,
+                                       sizeof( TraceProcess ) * newCapacity );
+      for( index = traceCapacity; index < newCapacity; index++ )
+      {
+         traceProcesses[ index ].named = False;
+         traceProcesses[ index ].opOpen = False;
+         traceProcesses[ index ].runStartUs = -1;
+         traceProcesses[ index ].mmuStartUs = 0;
+      }
+      traceCapacity = newCapacity;
+   }
+
+   process = &traceProcesses[ pId ];
+   if( process->named == False )
+   {
+      process->named = True;
+      sprintf( trackName, "Process %d", pId );
+      traceThreadName( TRACE_PID_PROCESSES, pId, trackName );
+   }
+
+   return process;
+}
+
+/*
+Function name: traceName
+Algorithm: skips the padding the event data puts before an op type
+Precondition: opType from generateEventData
+Postcondition: returns the op type without leading spaces
+Exceptions: none
+Notes: none
+*/
+static char* traceName( char* opType )
+{
+   while( *opType == SPACE )
+   {
+      opType++;
+   }
+
+   return opType;
+}
+
+/*
+Function name: traceSlice
+Algorithm: writes a complete event, from its start and end
+Precondition: trace open
+Postcondition: slice written on the track
+Exceptions: none
+Notes: none
+*/
+static void traceSlice( int tracePid, int traceTid, const char* name,
+                                          long long startUs, long long endUs )
+{
+   fprintf( traceFile, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,"
+                        "\"tid\":%d,\"ts\":%lld,\"dur\":%lld}",
+                  name, tracePid, traceTid, startUs, endUs - startUs );
+}
+
+/*
+Function name: traceInstant
+Algorithm: writes an instant event
+Precondition: trace open, scope is t for the track, p for its group
+Postcondition: instant written
+Exceptions: none
+Notes: none
+*/
+static void traceInstant( int tracePid, int traceTid, const char* name,
+                                             long long timeUs, char scope )
+{
+   fprintf( traceFile, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"%c\","
+                        "\"pid\":%d,\"tid\":%d,\"ts\":%lld}",
+                  name, scope, tracePid, traceTid, timeUs );
+}
+
+/*
+Function name: traceRequest
+Algorithm: writes an I/O request as a begin and end pair of async events
+            named by the device, keyed by the process
+Precondition: trace open
+Postcondition: request written on the device's track
+Exceptions: none
+Notes: a device with several channels serves requests at once, async
+       slices may overlap where complete events must nest
+*/
+static void traceRequest( int deviceCode, int pId, long long startUs,
+                                                            long long endUs )
+{
+   fprintf( traceFile, ",\n{\"name\":\"%s\",\"cat\":\"io\",\"ph\":\"b\","
+                     "\"id\":%d,\"pid\":%d,\"tid\":%d,\"ts\":%lld}",
+               getDeviceName( deviceCode ), pId, TRACE_PID_DEVICES,
+                                                         deviceCode, startUs );
+   fprintf( traceFile, ",\n{\"name\":\"%s\",\"cat\":\"io\",\"ph\":\"e\","
+                     "\"id\":%d,\"pid\":%d,\"tid\":%d,\"ts\":%lld}",
+               getDeviceName( deviceCode ), pId, TRACE_PID_DEVICES,
+                                                         deviceCode, endUs );
+}
+
+/*
+Function name: traceThreadName
+Algorithm: writes the metadata event naming a track
+Precondition: trace open
+Postcondition: track named
+Exceptions: none
+Notes: none
+*/
+static void traceThreadName( int tracePid, int traceTid, const char* name )
+{
+   fprintf( traceFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+                        "\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                  tracePid, traceTid, name );
+}
+
+/*
+Function name: traceRunEnd
+Algorithm: closes the process's running slice on its core's track
+Precondition: trace open
+Postcondition: slice written, if the process was running
+Exceptions: none
+Notes: none
+*/
+static void traceRunEnd( TraceProcess* process, int pId, long long nowUs )
+{
+   char sliceName[ STD_STR_LEN ];
+
+   if( process->runStartUs < 0 )
+   {
+      return;
+   }
+
+   sprintf( sliceName, "Process %d", pId );
+   traceSlice( TRACE_PID_CORES, process->runCore, sliceName,
+                                                process->runStartUs, nowUs );
+   process->runStartUs = -1;
+}
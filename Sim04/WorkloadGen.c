@@ -0,0 +1,625 @@
+//Program Information///////////////////////////////////////////////////////////
+/*
+ * @file WorkloadGen.c
+ *
+ *
+ * @version 5.48
+ *          Kristopher Moore (19 October 2026)
+ *          Synthetic workload generator, writes a matching .mdf and .cnf.
+ */
+
+#include <math.h>
+#include "StringUtils.h"
+
+//devices in the order of their weights on the command line
+#define GEN_DEVICE_COUNT 4
+
+//largest op value the meta data reader accepts is eight digits
+#define GEN_MAX_OP_VALUE 99999999
+
+//memory ops are SSBBBAAA, BBB is in KB and AAA the offset within it
+#define GEN_MAX_OFFSET 999
+
+//op value distributions
+typedef enum
+{
+   DIST_UNIFORM,
+   DIST_EXPONENTIAL,
+   DIST_PARETO
+
+} GenDistribution;
+
+//memory op patterns, valid ops never segfault, random ones mostly do
+typedef enum
+{
+   MEM_VALID,
+   MEM_RANDOM
+
+} GenMemoryPattern;
+
+//everything the command line can set
+typedef struct
+{
+   char baseName[ 100 ];
+   int processCount;
+   long long opsPerProcess;
+   int mixWeights[ 4 ];
+   int deviceWeights[ GEN_DEVICE_COUNT ];
+   GenDistribution distribution;
+   int meanCycles;
+   int maxCycles;
+   GenMemoryPattern memoryPattern;
+   int memAvailable;
+   int seed;
+   char schedCode[ 20 ];
+   char clockName[ 20 ];
+   char logTo[ 20 ];
+
+} GenOptions;
+
+//function prototypes
+void setGenDefaults( GenOptions* options );
+Boolean parseGenOptions( int argc, char** argv, GenOptions* options );
+Boolean parseWeights( char* weightStr, int* weights, int count );
+void showGenUsage( void );
+unsigned long long genNextRandom( unsigned long long* randomState );
+double genNextUnit( unsigned long long* randomState );
+int pickWeighted( int* weights, int count, unsigned long long* randomState );
+int drawOpValue( GenOptions* options, unsigned long long* randomState );
+int nextMemoryOp( GenOptions* options, int pId, int* nextBase, int* ownBase,
+               Boolean* allocate, unsigned long long* randomState );
+Boolean writeMetaData( GenOptions* options, char* fileName );
+Boolean writeConfig( GenOptions* options, char* fileName, char* mdfName );
+
+/*
+Function name: main
+Algorithm: reads the options, then writes the meta data file and a config
+            file that runs it
+Precondition: none
+Postcondition: returns zero (0) on success
+Exceptions: bad options print the usage, unwritable files are reported
+Notes: the same options and seed always write the same files
+*/
+int main( int argc, char** argv )
+{
+   GenOptions options;
+   char mdfName[ MAX_STR_LEN ];
+   char cnfName[ MAX_STR_LEN ];
+
+   setGenDefaults( &options );
+   if( parseGenOptions( argc, argv, &options ) == False )
+   {
+      showGenUsage();
+      return 1;
+   }
+
+   sprintf( mdfName, "%s.mdf", options.baseName );
+   sprintf( cnfName, "%s.cnf", options.baseName );
+
+   if( writeMetaData( &options, mdfName ) == False
+                     || writeConfig( &options, cnfName, mdfName ) == False )
+   {
+      return 1;
+   }
+
+   printf( "Wrote %s and %s, %d processes of %lld ops\n", mdfName, cnfName,
+                              options.processCount, options.opsPerProcess );
+   return 0;
+}
+
+/*
+Function name: setGenDefaults
+Algorithm: assigns the default of every option
+Precondition: none
+Postcondition: options hold their defaults
+Exceptions: none
+Notes: defaults are close to the checked in meta data files
+*/
+void setGenDefaults( GenOptions* options )
+{
+   copyString( options->baseName, "workload" );
+   options->processCount = 10;
+   options->opsPerProcess = 20;
+
+   //P, I, O, M weights
+   options->mixWeights[ 0 ] = 50;
+   options->mixWeights[ 1 ] = 20;
+   options->mixWeights[ 2 ] = 20;
+   options->mixWeights[ 3 ] = 10;
+
+   //hard drive, keyboard, printer, monitor weights
+   options->deviceWeights[ 0 ] = 1;
+   options->deviceWeights[ 1 ] = 1;
+   options->deviceWeights[ 2 ] = 1;
+   options->deviceWeights[ 3 ] = 1;
+
+   options->distribution = DIST_UNIFORM;
+   options->meanCycles = 10;
+   options->maxCycles = 1000;
+   options->memoryPattern = MEM_VALID;
+   options->memAvailable = 102400;
+   options->seed = 1;
+   copyString( options->schedCode, "FCFS-N" );
+   copyString( options->clockName, "Virtual" );
+   copyString( options->logTo, "File" );
+}
+
+/*
+Function name: parseGenOptions
+Algorithm: reads each flag and the value after it
+Precondition: options hold their defaults
+Postcondition: returns True with options set, False on a bad flag or value
+Exceptions: none
+Notes: none
+*/
+Boolean parseGenOptions( int argc, char** argv, GenOptions* options )
+{
+   int index;
+   char* flag;
+   char* value;
+
+   for( index = 1; index < argc; index += 2 )
+   {
+      flag = argv[ index ];
+      if( index + 1 >= argc )
+      {
+         return False;
+      }
+      value = argv[ index + 1 ];
+
+      if( compareString( flag, "--name" ) == STR_EQ
+                                       && getStringLength( value ) < 90 )
+      {
+         copyString( options->baseName, value );
+      }
+      else if( compareString( flag, "--processes" ) == STR_EQ )
+      {
+         options->processCount = atoi( value );
+      }
+      else if( compareString( flag, "--ops" ) == STR_EQ )
+      {
+         options->opsPerProcess = atoll( value );
+      }
+      else if( compareString( flag, "--mix" ) == STR_EQ )
+      {
+         if( parseWeights( value, options->mixWeights, 4 ) == False )
+         {
+            return False;
+         }
+      }
+      else if( compareString( flag, "--devices" ) == STR_EQ )
+      {
+         if( parseWeights( value, options->deviceWeights,
+                                             GEN_DEVICE_COUNT ) == False )
+         {
+            return False;
+         }
+      }
+      else if( compareString( flag, "--dist" ) == STR_EQ )
+      {
+         if( compareString( value, "uniform" ) == STR_EQ )
+         {
+            options->distribution = DIST_UNIFORM;
+         }
+         else if( compareString( value, "exponential" ) == STR_EQ )
+         {
+            options->distribution = DIST_EXPONENTIAL;
+         }
+         else if( compareString( value, "pareto" ) == STR_EQ )
+         {
+            options->distribution = DIST_PARETO;
+         }
+         else
+         {
+            return False;
+         }
+      }
+      else if( compareString( flag, "--mean" ) == STR_EQ )
+      {
+         options->meanCycles = atoi( value );
+      }
+      else if( compareString( flag, "--max" ) == STR_EQ )
+      {
+         options->maxCycles = atoi( value );
+      }
+      else if( compareString( flag, "--memory" ) == STR_EQ )
+      {
+         if( compareString( value, "valid" ) == STR_EQ )
+         {
+            options->memoryPattern = MEM_VALID;
+         }
+         else if( compareString( value, "random" ) == STR_EQ )
+         {
+            options->memoryPattern = MEM_RANDOM;
+         }
+         else
+         {
+            return False;
+         }
+      }
+      else if( compareString( flag, "--seed" ) == STR_EQ )
+      {
+         options->seed = atoi( value );
+      }
+      else if( compareString( flag, "--sched" ) == STR_EQ
+                                       && getStringLength( value ) < 20 )
+      {
+         copyString( options->schedCode, value );
+      }
+      else if( compareString( flag, "--clock" ) == STR_EQ
+                                       && getStringLength( value ) < 20 )
+      {
+         copyString( options->clockName, value );
+      }
+      else if( compareString( flag, "--log" ) == STR_EQ
+                                       && getStringLength( value ) < 20 )
+      {
+         copyString( options->logTo, value );
+      }
+      else
+      {
+         return False;
+      }
+   }
+
+   //every process needs at least one op, and values the reader accepts
+   return options->processCount > 0 && options->opsPerProcess > 0
+            && options->meanCycles > 0 && options->maxCycles > 0
+            && options->maxCycles <= GEN_MAX_OP_VALUE && options->seed >= 0;
+}
+
+/*
+Function name: parseWeights
+Algorithm: reads a comma separated list of count non-negative weights
+Precondition: weights has room for count values
+Postcondition: returns True with the weights set, when they do not all
+               come to zero
+Exceptions: none
+Notes: none
+*/
+Boolean parseWeights( char* weightStr, int* weights, int count )
+{
+   int index;
+   int total = 0;
+
+   for( index = 0; index < count; index++ )
+   {
+      if( *weightStr < '0' || *weightStr > '9' )
+      {
+         return False;
+      }
+
+      weights[ index ] = (int) strtol( weightStr, &weightStr, 10 );
+      total += weights[ index ];
+
+      if( index < count - 1 )
+      {
+         if( *weightStr != ',' )
+         {
+            return False;
+         }
+         weightStr++;
+      }
+   }
+
+   return *weightStr == NULL_CHAR && total > 0;
+}
+
+/*
+Function name: showGenUsage
+Algorithm: prints every flag and its default
+Precondition: none
+Postcondition: usage printed
+Exceptions: none
+Notes: none
+*/
+void showGenUsage( void )
+{
+   printf( "Usage: WorkloadGen [flag value]...\n" );
+   printf( "  --name base        writes base.mdf and base.cnf (workload)\n" );
+   printf( "  --processes n      processes (10)\n" );
+   printf( "  --ops n            ops per process, between start and end"
+                                                               " (20)\n" );
+   printf( "  --mix p,i,o,m      weights of P, I, O and M ops"
+                                                         " (50,20,20,10)\n" );
+   printf( "  --devices h,k,p,m  weights of hard drive, keyboard, printer"
+                                                " and monitor (1,1,1,1)\n" );
+   printf( "  --dist d           uniform, exponential or pareto op values"
+                                                            " (uniform)\n" );
+   printf( "  --mean n           mean op value in cycles (10)\n" );
+   printf( "  --max n            largest op value in cycles (1000)\n" );
+   printf( "  --memory m         valid or random memory ops (valid)\n" );
+   printf( "  --seed n           seed of every draw (1)\n" );
+   printf( "  --sched code       CPU Scheduling Code of the config"
+                                                            " (FCFS-N)\n" );
+   printf( "  --clock c          Simulation Clock of the config (Virtual)\n" );
+   printf( "  --log l            Log To of the config (File)\n" );
+}
+
+/*
+Function name: genNextRandom
+Algorithm: xorshift64* step, the same generator the simulator draws from
+Precondition: non-zero state
+Postcondition: state advanced, returns the next random value
+Exceptions: none
+Notes: none
+*/
+unsigned long long genNextRandom( unsigned long long* randomState )
+{
+   *randomState ^= *randomState >> 12;
+   *randomState ^= *randomState << 25;
+   *randomState ^= *randomState >> 27;
+
+   return *randomState * 2685821657736338717ULL;
+}
+
+/*
+Function name: genNextUnit
+Algorithm: scales the top 53 bits of the next random value into [0, 1)
+Precondition: non-zero state
+Postcondition: state advanced, returns the next random fraction
+Exceptions: none
+Notes: none
+*/
+double genNextUnit( unsigned long long* randomState )
+{
+   return ( genNextRandom( randomState ) >> 11 )
+                                          * ( 1.0 / 9007199254740992.0 );
+}
+
+/*
+Function name: pickWeighted
+Algorithm: draws an index with chance in proportion to its weight
+Precondition: weights not all zero
+Postcondition: returns the index drawn
+Exceptions: none
+Notes: none
+*/
+int pickWeighted( int* weights, int count, unsigned long long* randomState )
+{
+   int total = 0;
+   int index;
+   int draw;
+
+   for( index = 0; index < count; index++ )
+   {
+      total += weights[ index ];
+   }
+
+   draw = (int) ( genNextRandom( randomState ) % (unsigned long long) total );
+   for( index = 0; draw >= weights[ index ]; index++ )
+   {
+      draw -= weights[ index ];
+   }
+
+   return index;
+}
+
+/*
+Function name: drawOpValue
+Algorithm: draws an op value in cycles from the chosen distribution, uniform
+            over 1 to twice the mean, exponential, or Pareto with a shape of
+            1.5 for a heavy tail, all with the given mean
+Precondition: valid options
+Postcondition: returns a value from 1 to the largest op value
+Exceptions: none
+Notes: the cap shortens the tails, so capped means come out a little low
+*/
+int drawOpValue( GenOptions* options, unsigned long long* randomState )
+{
+   double unit = genNextUnit( randomState );
+   double value;
+
+   switch( options->distribution )
+   {
+      case DIST_EXPONENTIAL:
+         value = ceil( -options->meanCycles * log( 1.0 - unit ) );
+         break;
+
+      case DIST_PARETO:
+         value = ceil( options->meanCycles / 3.0
+                                          / pow( 1.0 - unit, 1.0 / 1.5 ) );
+         break;
+
+      default:
+         value = 1 + floor( unit * ( 2 * options->meanCycles - 1 ) );
+         break;
+   }
+
+   if( value < 1 )
+   {
+      value = 1;
+   }
+
+   if( value > options->maxCycles )
+   {
+      value = options->maxCycles;
+   }
+
+   return (int) value;
+}
+
+/*
+Function name: nextMemoryOp
+Algorithm: valid ops give each process one fresh base the first time it
+            needs memory, while bases last, then access inside it, random
+            ops draw every field
+Precondition: bases, in KB, are never shared, so only about
+               memAvailable / 1024 allocations can succeed
+Postcondition: returns the SSBBBAAA value, and whether it is an allocate,
+               or -1 when a valid op is not possible
+Exceptions: none
+Notes: the segment is 1 to 99, so the value always has all eight digits'
+       worth of fields for getMemoryRequest
+*/
+int nextMemoryOp( GenOptions* options, int pId, int* nextBase, int* ownBase,
+                  Boolean* allocate, unsigned long long* randomState )
+{
+   int segment = 1 + pId % 99;
+   int lastBase = ( options->memAvailable - GEN_MAX_OFFSET ) / 1024;
+   int offset;
+
+   if( options->memoryPattern == MEM_RANDOM )
+   {
+      *allocate = ( genNextRandom( randomState ) & 1 ) ? True : False;
+      return (int) ( 1 + genNextRandom( randomState ) % 99 ) * 1000000
+               + (int) ( genNextRandom( randomState ) % 100 ) * 1000
+               + (int) ( genNextRandom( randomState )
+                                             % ( GEN_MAX_OFFSET + 1 ) );
+   }
+
+   //allocate the whole of a fresh base, later ops access an offset in it
+   if( *ownBase < 0 )
+   {
+      if( *nextBase > lastBase )
+      {
+         return -1;
+      }
+
+      *ownBase = ( *nextBase )++;
+      *allocate = True;
+      return segment * 1000000 + *ownBase * 1000 + GEN_MAX_OFFSET;
+   }
+
+   offset = (int) ( genNextRandom( randomState ) % ( GEN_MAX_OFFSET + 1 ) );
+   *allocate = False;
+   return segment * 1000000 + *ownBase * 1000 + offset;
+}
+
+/*
+Function name: writeMetaData
+Algorithm: writes each process as start, its drawn ops and end, eight ops to
+            a line like the checked in files
+Precondition: valid options
+Postcondition: meta data file written, returns True
+Exceptions: returns False if the file cannot be written
+Notes: buffered writes, a few million ops take seconds
+*/
+Boolean writeMetaData( GenOptions* options, char* fileName )
+{
+   const char* deviceNames[ GEN_DEVICE_COUNT ] =
+                        { "hard drive", "keyboard", "printer", "monitor" };
+   unsigned long long randomState =
+                     (unsigned long long) options->seed * 2654435761ULL + 1;
+   FILE* filePtr = fopen( fileName, "w" );
+   long long opIndex;
+   long long lineOps = 2;
+   int pId;
+   int opKind;
+   int opValue = 0;
+   int device;
+   int nextBase = 0;
+   int ownBase;
+   Boolean allocate = False;
+
+   if( filePtr == NULL )
+   {
+      printf( "Unable to write %s\n", fileName );
+      return False;
+   }
+   setvbuf( filePtr, NULL, _IOFBF, 1 << 20 );
+
+   fprintf( filePtr, "Start Program Meta-Data Code:\nS(start)0; " );
+   for( pId = 0; pId < options->processCount; pId++ )
+   {
+      ownBase = -1;
+      fprintf( filePtr, "A(start)0; " );
+
+      for( opIndex = 0; opIndex < options->opsPerProcess; opIndex++ )
+      {
+         opKind = pickWeighted( options->mixWeights, 4, &randomState );
+
+         //no memory left for a valid op, run instead
+         if( opKind == 3 )
+         {
+            opValue = nextMemoryOp( options, pId, &nextBase, &ownBase,
+                                                   &allocate, &randomState );
+            if( opValue < 0 )
+            {
+               opKind = 0;
+            }
+         }
+
+         switch( opKind )
+         {
+            case 0:
+               fprintf( filePtr, "P(run)%d;",
+                                    drawOpValue( options, &randomState ) );
+               break;
+
+            case 1:
+            case 2:
+               device = pickWeighted( options->deviceWeights,
+                                             GEN_DEVICE_COUNT, &randomState );
+               fprintf( filePtr, "%c(%s)%d;", opKind == 1 ? 'I' : 'O',
+                                 deviceNames[ device ],
+                                       drawOpValue( options, &randomState ) );
+               break;
+
+            default:
+               fprintf( filePtr, "M(%s)%d;",
+                        allocate == True ? "allocate" : "access", opValue );
+               break;
+         }
+
+         lineOps++;
+         fprintf( filePtr, lineOps % 8 == 0 ? "\n" : " " );
+      }
+
+      fprintf( filePtr, "A(end)0;" );
+      lineOps++;
+      fprintf( filePtr, lineOps % 8 == 0 ? "\n" : " " );
+   }
+
+   fprintf( filePtr, "S(end)0;\nEnd Program Meta-Data Code.\n" );
+
+   if( fclose( filePtr ) != 0 )
+   {
+      printf( "Unable to write %s\n", fileName );
+      return False;
+   }
+
+   return True;
+}
+
+/*
+Function name: writeConfig
+Algorithm: writes a config file running the meta data file, with the memory
+            the valid memory ops were drawn for, and the seed
+Precondition: valid options
+Postcondition: config file written, returns True
+Exceptions: returns False if the file cannot be written
+Notes: none
+*/
+Boolean writeConfig( GenOptions* options, char* fileName, char* mdfName )
+{
+   FILE* filePtr = fopen( fileName, "w" );
+
+   if( filePtr == NULL )
+   {
+      printf( "Unable to write %s\n", fileName );
+      return False;
+   }
+
+   fprintf( filePtr, "Start Simulator Configuration File:\n" );
+   fprintf( filePtr, "Version/Phase: 1.05\n" );
+   fprintf( filePtr, "File Path: %s\n", mdfName );
+   fprintf( filePtr, "CPU Scheduling Code: %s\n", options->schedCode );
+   fprintf( filePtr, "Quantum Time (cycles): 3\n" );
+   fprintf( filePtr, "Memory Available (KB): %d\n", options->memAvailable );
+   fprintf( filePtr, "Processor Cycle Time (msec): 10\n" );
+   fprintf( filePtr, "I/O Cycle Time (msec): 20\n" );
+   fprintf( filePtr, "Log To: %s\n", options->logTo );
+   fprintf( filePtr, "Log File Path: logfile_1.lgf\n" );
+   fprintf( filePtr, "Simulation Clock: %s\n", options->clockName );
+   fprintf( filePtr, "Random Seed: %d\n", options->seed );
+   fprintf( filePtr, "End Simulator Configuration File.\n" );
+
+   if( fclose( filePtr ) != 0 )
+   {
+      printf( "Unable to write %s\n", fileName );
+      return False;
+   }
+
+   return True;
+}
@@ -21,6 +21,9 @@
 #ifndef SIMTIMER_C
 #define SIMTIMER_C
 
+// clock_gettime is POSIX, not C99
+#define _POSIX_C_SOURCE 199309L
+
 // Header files ///////////////////////////////////////////////////////////////
 
 #include "simtimer.h"
@@ -63,11 +66,8 @@ void runTimer( int milliSeconds )
        }
    }
 
-double accessTimer( int controlCode, char *timeStr )
+double accessTimer( SimTimer *timer, int controlCode, char *timeStr )
    {
-    static int running = 0;
-    static int startSec = 0, endSec = 0, startUSec = 0, endUSec = 0;
-    static int lapSec = 0, lapUSec = 0;
     struct timeval startData, lapData, endData;
     double fpTime = 0.0;
 
@@ -75,28 +75,28 @@ double accessTimer( int controlCode, char *timeStr )
        {
         case ZERO_TIMER:
            gettimeofday( &startData, NULL );
-           running = 1;
+           timer->running = 1;
 
-           startSec = startData.tv_sec;
-           startUSec = startData.tv_usec;
+           timer->startSec = startData.tv_sec;
+           timer->startUSec = startData.tv_usec;
 
            fpTime = 0.000000000;
-           lapSec = 0.000000000;
-           lapUSec = 0.000000000;
+           timer->lapSec = 0.000000000;
+           timer->lapUSec = 0.000000000;
 
-           timeToString( lapSec, lapUSec, timeStr ); 
+           timeToString( timer->lapSec, timer->lapUSec, timeStr ); 
            break;
            
         case LAP_TIMER:
-           if( running == 1 )
+           if( timer->running == 1 )
               {
                gettimeofday( &lapData, NULL );
 
-               lapSec = lapData.tv_sec;
-               lapUSec = lapData.tv_usec;
+               timer->lapSec = lapData.tv_sec;
+               timer->lapUSec = lapData.tv_usec;
 
-               fpTime = processTime( startSec, lapSec, 
-                                                 startUSec, lapUSec, timeStr );
+               fpTime = processTime( timer->startSec, timer->lapSec, 
+                                   timer->startUSec, timer->lapUSec, timeStr );
               }
 
            else
@@ -106,16 +106,16 @@ double accessTimer( int controlCode, char *timeStr )
            break;
 
         case STOP_TIMER:
-           if( running == 1 )
+           if( timer->running == 1 )
               {
                gettimeofday( &endData, NULL );
-               running = 0;
+               timer->running = 0;
 
-               endSec = endData.tv_sec;
-               endUSec = endData.tv_usec;
+               timer->endSec = endData.tv_sec;
+               timer->endUSec = endData.tv_usec;
 
-               fpTime = processTime( startSec, endSec, 
-                                                 startUSec, endUSec, timeStr );
+               fpTime = processTime( timer->startSec, timer->endSec, 
+                                   timer->startUSec, timer->endUSec, timeStr );
               }
 
            // assume timer not running
@@ -223,6 +223,30 @@ void timeToString( int secTime, int uSecTime, char *timeStr )
        }
    }
 
+/* Reads the wall clock as a single micro-second count, for measuring
+   intervals from threads without touching a SimTimer
+*/
+long long wallTimeUs( void )
+   {
+    struct timeval nowTime;
+
+    gettimeofday( &nowTime, NULL );
+
+    return (long long) nowTime.tv_sec * 1000000 + nowTime.tv_usec;
+   }
+
+/* Reads a monotonic clock as a single nano-second count, for timing spans
+   too short for wallTimeUs
+*/
+long long wallTimeNs( void )
+   {
+    struct timespec nowTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &nowTime );
+
+    return (long long) nowTime.tv_sec * 1000000000 + nowTime.tv_nsec;
+   }
+
 #endif // ifndef SIMTIMER_C
 
 
@@ -22,6 +22,7 @@
 // Header files ///////////////////////////////////////////////////////////////
 
 #include <sys/time.h>
+#include <time.h>
 #include <string.h>
 #include <math.h>
 //#include "mainprog.h"
@@ -33,13 +34,25 @@ enum TIMER_CTRL_CODES { ZERO_TIMER, LAP_TIMER, STOP_TIMER };
 extern const char RADIX_POINT;
 extern const char SPACE;
 
+// Data Types  ////////////////////////////////////////////////////////////////
+
+// state of one timer, each simulation run keeps its own
+typedef struct
+   {
+    int running;
+    int startSec, endSec, startUSec, endUSec;
+    int lapSec, lapUSec;
+   } SimTimer;
+
 // Function Prototypes  /////////////////////////////////////////////////////////
 
 void runTimer( int milliSeconds );
-double accessTimer( int controlCode, char *timeStr );
+double accessTimer( SimTimer *timer, int controlCode, char *timeStr );
 double processTime( double startSec, double endSec, 
                            double startUSec, double endUSec, char *timeStr );
 void timeToString( int secTime, int uSecTime, char *timeStr );
+long long wallTimeUs( void );
+long long wallTimeNs( void );
 
 #endif // ifndef SIMTIMER_H
 